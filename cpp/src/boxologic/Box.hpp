@@ -30,10 +30,5 @@ namespace boxologic
 		 * @brief Coordinate-Z of the box placement in a Pallet
 		 */
 		double coz;
-
-		/**
-		 * Whether the Box is packed into a Pallet.
-		 */
-		bool is_packed;
 	};
 };
\ No newline at end of file
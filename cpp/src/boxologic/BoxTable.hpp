@@ -0,0 +1,565 @@
+#pragma once
+#include <boxologic/Box.hpp>
+#include <boxologic/BoxType.hpp>
+#include <boxologic/LayerEvaluator.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <climits>
+#include <limits>
+
+// AVX2 FUNCTIONS ARE COMPILED FOR THE TARGET, WHATEVER THE COMPILER OPTIONS, AND DISPATCHED AT RUNTIME
+#if defined(_M_X64) || defined(__x86_64__)
+#	define BOXOLOGIC_AVX2
+#	include <immintrin.h>
+#	ifdef _MSC_VER
+#		include <intrin.h>
+#		define BOXOLOGIC_TARGET_AVX2
+#	else
+#		define BOXOLOGIC_TARGET_AVX2 __attribute__((target("avx2")))
+#	endif
+#endif
+
+namespace boxologic
+{
+	/**
+	 * @brief A box fitting to a gap, found by BoxTable::find().
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	struct BoxFit
+	{
+	public:
+		/**
+		 * @brief Index of the box. -1 if there's not any box fitting to the gap.
+		 */
+		size_t index;
+
+		/**
+		 * @brief Dimensions of the box, in the fitting orientation.
+		 */
+		double x, y, z;
+
+		/**
+		 * @brief Gaps between the box and the space.
+		 */
+		double fx, fy, fz;
+	};
+
+	/**
+	 * @brief A structure-of-arrays table of boxes.
+	 *
+	 * @details
+	 * <p> BoxTable groups boxes having same dimensions into a {@link BoxType type} with count of remained
+	 * (not packed) boxes, so that searches of Boxologic scale with number of types, not number of boxes.
+	 * Boxes of a type are identical each other, thus the first remained box of the type is always the
+	 * box to be packed. </p>
+	 *
+	 * <p> For Boxologic::find_box(), the innermost loop of packing, BoxTable stores dimensions of each
+	 * type in all six orientations as contiguous arrays and whether each type is exhausted as a bitset.
+	 * Candidates of many types are evaluated by an instruction with AVX2, if the CPU supports it. Otherwise,
+	 * they're evaluated by a scalar loop. The AVX2 path is compiled on x64 regardless of compiler options,
+	 * by a target attribute of GCC and Clang (intrinsics of MSVC need no option), and chosen by a CPUID check
+	 * at runtime; see supports_avx2(). </p>
+	 *
+	 * <p> Orientations of a type duplicating a former one (e.g. all orientations of a cube) are disabled,
+	 * because such an orientation cannot be a better candidate than the former. </p>
+	 *
+	 * <p> Both paths deduct the same BoxFit, which is same with the original loop of boxologic iterating
+	 * each box: the lexicographically minimal gap (fy, fx, fz) and the first one by (index, orientation)
+	 * in a tie. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class BoxTable
+	{
+	private:
+		/**
+		 * @brief Types of the boxes, in order of their first occurences.
+		 */
+		std::vector<BoxType> types;
+
+		/**
+		 * @brief Index of type of each box.
+		 */
+		std::vector<size_t> box_types;
+
+		/**
+		 * @brief Index of type of each SKU, given by assign(boxes, skus). -1 if not met yet.
+		 */
+		std::vector<size_t> sku_types;
+
+		/**
+		 * @brief Bitset of packed boxes.
+		 */
+		std::vector<uint64_t> packed;
+
+		/**
+		 * @brief Dimensions of types; [orientation][axis][type].
+		 *
+		 * @details Arrays are padded to a multiple of 4. Disabled orientations and paddings have infinity.
+		 */
+		std::vector<double> dims[6][3];
+
+		/**
+		 * @brief Index of the first remained box of each type, in the padded array.
+		 */
+		std::vector<double> fronts;
+
+		/**
+		 * @brief Bitset of exhausted types. Paddings are always exhausted.
+		 */
+		std::vector<uint64_t> exhausted;
+
+		/**
+		 * @brief Evaluator of layer thicknesses, about remained boxes.
+		 */
+		LayerEvaluator layer_evaluator;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Assign boxes.
+		 *
+		 * @details All boxes are not packed.
+		 */
+		void assign(const std::vector<Box> &boxes)
+		{
+			assign(boxes, std::vector<uint32_t>());
+		};
+
+		/**
+		 * @brief Assign boxes with their SKU ids.
+		 *
+		 * @details
+		 * <p> Boxes of a same SKU have same dimensions, thus type of a box is found by its SKU id, without
+		 * comparing dimensions with all types. Only the first box of each SKU is compared, because
+		 * different SKUs can have same dimensions. Types are same with assign(boxes). </p>
+		 *
+		 * @param boxes Boxes to be packed.
+		 * @param skus SKU id of each box. If empty, types are found by dimensions.
+		 */
+		void assign(const std::vector<Box> &boxes, const std::vector<uint32_t> &skus)
+		{
+			types.clear();
+			box_types.assign(boxes.size(), 0);
+			sku_types.clear();
+
+			// GROUP BOXES INTO TYPES
+			for (size_t i = 0; i < boxes.size(); i++)
+			{
+				const Box &box = boxes[i];
+
+				if (skus.empty() == false)
+				{
+					if (skus[i] >= sku_types.size())
+						sku_types.resize(skus[i] + 1, (size_t)-1);
+
+					if (sku_types[skus[i]] != (size_t)-1)
+					{
+						types[sku_types[skus[i]]].indices.push_back(i);
+						box_types[i] = sku_types[skus[i]];
+						continue;
+					}
+				}
+				size_t t = 0;
+
+				while (t < types.size() &&
+					(types[t].width != box.width || types[t].height != box.height || types[t].length != box.length))
+					t++;
+
+				if (t == types.size())
+				{
+					BoxType type;
+					type.width = box.width;
+					type.height = box.height;
+					type.length = box.length;
+
+					types.push_back(type);
+				}
+				types[t].indices.push_back(i);
+				box_types[i] = t;
+
+				if (skus.empty() == false)
+					sku_types[skus[i]] = t;
+			}
+
+			// DIMENSIONS OF EACH ORIENTATION
+			size_t capacity = (types.size() + 3) / 4 * 4;
+
+			for (size_t o = 0; o < 6; o++)
+				for (size_t a = 0; a < 3; a++)
+					dims[o][a].assign(capacity, std::numeric_limits<double>::infinity());
+
+			for (size_t t = 0; t < types.size(); t++)
+			{
+				const BoxType &type = types[t];
+				double orientations[6][3] =
+				{
+					{ type.width, type.height, type.length },
+					{ type.width, type.length, type.height },
+					{ type.height, type.width, type.length },
+					{ type.height, type.length, type.width },
+					{ type.length, type.width, type.height },
+					{ type.length, type.height, type.width }
+				};
+
+				for (size_t o = 0; o < 6; o++)
+				{
+					// SKIP DUPLICATED ORIENTATION
+					bool duplicated = false;
+					for (size_t p = 0; p < o && duplicated == false; p++)
+						duplicated = orientations[o][0] == orientations[p][0]
+							&& orientations[o][1] == orientations[p][1]
+							&& orientations[o][2] == orientations[p][2];
+
+					if (duplicated == true)
+						continue;
+
+					for (size_t a = 0; a < 3; a++)
+						dims[o][a][t] = orientations[o][a];
+				}
+			}
+
+			layer_evaluator.assign(types);
+
+			fronts.assign(capacity, 0);
+			packed.assign(boxes.size() / 64 + 1, 0);
+			exhausted.assign(capacity / 64 + 1, 0);
+
+			unpack_all();
+		};
+
+		/* -----------------------------------------------------------
+			ACCESSORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get types of the boxes.
+		 */
+		auto get_types() const -> const std::vector<BoxType>&
+		{
+			return types;
+		};
+
+		/**
+		 * @brief Whether a box is packed.
+		 */
+		auto is_packed(size_t index) const -> bool
+		{
+			return test(packed, index);
+		};
+
+		/**
+		 * @brief Mark a box as packed.
+		 *
+		 * @param index Index of the box, which must be the first remained box of its type.
+		 */
+		void pack(size_t index)
+		{
+			BoxType &type = types[box_types[index]];
+
+			set(packed, index);
+			layer_evaluator.remove(box_types[index]);
+			type.remaining--;
+
+			if (type.remaining == 0)
+				set(exhausted, box_types[index]);
+			else
+				fronts[box_types[index]] = (double)type.front();
+		};
+
+		/**
+		 * @brief Mark all boxes as not packed.
+		 */
+		void unpack_all()
+		{
+			std::fill(packed.begin(), packed.end(), 0);
+			std::fill(exhausted.begin(), exhausted.end(), 0);
+			layer_evaluator.reset();
+
+			for (size_t t = 0; t < types.size(); t++)
+			{
+				types[t].remaining = types[t].indices.size();
+				fronts[t] = (double)types[t].front();
+			}
+
+			// PADDINGS ARE EXHAUSTED
+			for (size_t t = types.size(); t < exhausted.size() * 64; t++)
+				set(exhausted, t);
+		};
+
+		/* -----------------------------------------------------------
+			FINDERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Evaluate a layer thickness.
+		 *
+		 * @param thickness The layer thickness.
+		 * @return Sum of minimum gaps between the thickness and dimensions of remained boxes.
+		 *
+		 * @see LayerEvaluator
+		 */
+		auto evaluate_layer(double thickness) const -> double
+		{
+			return layer_evaluator.evaluate(thickness);
+		};
+
+		/**
+		 * @brief Find the best fitting boxes to a gap.
+		 *
+		 * @param hmx Maximum available x-dimension of the current gap to be filled.
+		 * @param hy Current layer thickness value.
+		 * @param hmy Current layer thickness value.
+		 * @param hz Z-dimension of the current gap to be filled.
+		 * @param hmz Maximum available z-dimension to the current gap to be filled.
+		 * @param within The best box, of which y-dimension is not greater than <i>hy</i>.
+		 * @param beyond The best box, of which y-dimension is greater than <i>hy</i>.
+		 */
+		void find(double hmx, double hy, double hmy, double hz, double hmz, BoxFit &within, BoxFit &beyond) const
+		{
+			within = { (size_t)-1, 0, 0, 0, INT_MAX, INT_MAX, INT_MAX };
+			beyond = { (size_t)-1, 0, 0, 0, INT_MAX, INT_MAX, INT_MAX };
+
+#ifdef BOXOLOGIC_AVX2
+			if (supports_avx2() == true)
+			{
+				find_avx2(hmx, hy, hmy, hz, hmz, within, beyond);
+				return;
+			}
+#endif
+			find_scalar(hmx, hy, hmy, hz, hmz, within, beyond);
+		};
+
+		/**
+		 * @brief Find the best fitting boxes to a gap, by a scalar loop.
+		 *
+		 * @details Same with find(), but never vectorized. Both <i>within</i> and <i>beyond</i> must be
+		 * initialized like find() does.
+		 */
+		void find_scalar(double hmx, double hy, double hmy, double hz, double hmz, BoxFit &within, BoxFit &beyond) const
+		{
+			double within_key = -1;
+			double beyond_key = -1;
+
+			for (size_t t = 0; t < types.size(); t++)
+			{
+				if (test(exhausted, t) == true)
+					continue;
+
+				for (size_t o = 0; o < 6; o++)
+				{
+					double dim1 = dims[o][0][t];
+					double dim2 = dims[o][1][t];
+					double dim3 = dims[o][2][t];
+
+					// OUT OF BOUNDARY RANGE
+					if (dim1 > hmx || dim2 > hmy || dim3 > hmz)
+						continue;
+
+					double fx = hmx - dim1;
+					double fz = std::abs(hz - dim3);
+					double key = fronts[t] * 6 + o;
+
+					if (dim2 <= hy)
+						update(within, within_key, key, dim1, dim2, dim3, fx, hy - dim2, fz);
+					else
+						update(beyond, beyond_key, key, dim1, dim2, dim3, fx, dim2 - hy, fz);
+				}
+			}
+		};
+
+	private:
+		static void update(BoxFit &fit, double &best_key, double key, double x, double y, double z, double fx, double fy, double fz)
+		{
+			// LEXICOGRAPHIC, AND THE FORMER BOX IN A TIE
+			if (fy < fit.fy || (fy == fit.fy && (fx < fit.fx || (fx == fit.fx &&
+				(fz < fit.fz || (fz == fit.fz && best_key >= 0 && key < best_key))))))
+			{
+				fit = { (size_t)key / 6, x, y, z, fx, fy, fz };
+				best_key = key;
+			}
+		};
+
+		static auto test(const std::vector<uint64_t> &bitset, size_t index) -> bool
+		{
+			return ((bitset[index >> 6] >> (index & 63)) & 1) != 0;
+		};
+
+		static void set(std::vector<uint64_t> &bitset, size_t index)
+		{
+			bitset[index >> 6] |= (uint64_t)1 << (index & 63);
+		};
+
+	public:
+		/**
+		 * @brief Whether the CPU and the OS support AVX2.
+		 *
+		 * @details Detected once, by CPUID. Always false if the AVX2 path is not compiled (not x64).
+		 */
+		static auto supports_avx2() -> bool
+		{
+#ifdef BOXOLOGIC_AVX2
+			static const bool supported = detect_avx2();
+			return supported;
+#else
+			return false;
+#endif
+		};
+
+#ifdef BOXOLOGIC_AVX2
+		/**
+		 * @brief Find the best fitting boxes to a gap, by AVX2.
+		 *
+		 * @details Same with find_scalar(), but four types are evaluated at once. Must be called only if
+		 * supports_avx2().
+		 */
+		BOXOLOGIC_TARGET_AVX2 void find_avx2(double hmx, double hy, double hmy, double hz, double hmz, BoxFit &within, BoxFit &beyond) const
+		{
+			const __m256d v_hmx = _mm256_set1_pd(hmx);
+			const __m256d v_hy = _mm256_set1_pd(hy);
+			const __m256d v_hmy = _mm256_set1_pd(hmy);
+			const __m256d v_hz = _mm256_set1_pd(hz);
+			const __m256d v_hmz = _mm256_set1_pd(hmz);
+			const __m256d sign = _mm256_set1_pd(-0.0);
+			const __m256i bits = _mm256_setr_epi64x(1, 2, 4, 8);
+
+			// BEST OF EACH LANE: GAPS AND KEY (INDEX * 6 + ORIENTATION)
+			__m256d w_fy = _mm256_set1_pd(INT_MAX), w_fx = w_fy, w_fz = w_fy, w_key = _mm256_set1_pd(-1);
+			__m256d b_fy = w_fy, b_fx = w_fy, b_fz = w_fy, b_key = w_key;
+
+			for (size_t t = 0; t < fronts.size(); t += 4)
+			{
+				long long nibble = (long long)((exhausted[t >> 6] >> (t & 63)) & 15);
+				if (nibble == 15)
+					continue; // ALL EXHAUSTED
+
+				__m256d remained = _mm256_castsi256_pd(_mm256_cmpeq_epi64
+				(
+					_mm256_and_si256(_mm256_set1_epi64x(nibble), bits),
+					_mm256_setzero_si256()
+				));
+				__m256d front = _mm256_mul_pd(_mm256_loadu_pd(&fronts[t]), _mm256_set1_pd(6));
+
+				for (size_t o = 0; o < 6; o++)
+				{
+					__m256d dim1 = _mm256_loadu_pd(&dims[o][0][t]);
+					__m256d dim2 = _mm256_loadu_pd(&dims[o][1][t]);
+					__m256d dim3 = _mm256_loadu_pd(&dims[o][2][t]);
+
+					__m256d in_range = _mm256_and_pd
+					(
+						_mm256_and_pd(remained, _mm256_cmp_pd(dim1, v_hmx, _CMP_LE_OQ)),
+						_mm256_and_pd(_mm256_cmp_pd(dim2, v_hmy, _CMP_LE_OQ), _mm256_cmp_pd(dim3, v_hmz, _CMP_LE_OQ))
+					);
+					if (_mm256_movemask_pd(in_range) == 0)
+						continue;
+
+					__m256d fx = _mm256_sub_pd(v_hmx, dim1);
+					__m256d fz = _mm256_andnot_pd(sign, _mm256_sub_pd(v_hz, dim3));
+					__m256d key = _mm256_add_pd(front, _mm256_set1_pd((double)o));
+					__m256d lower = _mm256_cmp_pd(dim2, v_hy, _CMP_LE_OQ);
+
+					update(_mm256_and_pd(in_range, lower), _mm256_sub_pd(v_hy, dim2), fx, fz, key, w_fy, w_fx, w_fz, w_key);
+					update(_mm256_andnot_pd(lower, in_range), _mm256_sub_pd(dim2, v_hy), fx, fz, key, b_fy, b_fx, b_fz, b_key);
+				}
+			}
+
+			reduce(w_fy, w_fx, w_fz, w_key, within);
+			reduce(b_fy, b_fx, b_fz, b_key, beyond);
+		};
+
+	private:
+		static auto detect_avx2() -> bool
+		{
+#ifdef _MSC_VER
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7)
+				return false;
+
+			// AVX AND ITS STATES SAVED BY THE OS
+			__cpuid(info, 1);
+			if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6)
+				return false;
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#else
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") != 0;
+#endif
+		};
+
+		BOXOLOGIC_TARGET_AVX2 static void update(__m256d mask, __m256d fy, __m256d fx, __m256d fz, __m256d key, __m256d &best_fy, __m256d &best_fx, __m256d &best_fz, __m256d &best_key)
+		{
+			// LEXICOGRAPHIC, AND THE FORMER BOX IN A TIE
+			__m256d fz_better = _mm256_or_pd
+			(
+				_mm256_cmp_pd(fz, best_fz, _CMP_LT_OQ),
+				_mm256_and_pd(_mm256_cmp_pd(fz, best_fz, _CMP_EQ_OQ), _mm256_cmp_pd(key, best_key, _CMP_LT_OQ))
+			);
+			__m256d better = _mm256_or_pd
+			(
+				_mm256_cmp_pd(fy, best_fy, _CMP_LT_OQ),
+				_mm256_and_pd
+				(
+					_mm256_cmp_pd(fy, best_fy, _CMP_EQ_OQ),
+					_mm256_or_pd
+					(
+						_mm256_cmp_pd(fx, best_fx, _CMP_LT_OQ),
+						_mm256_and_pd(_mm256_cmp_pd(fx, best_fx, _CMP_EQ_OQ), fz_better)
+					)
+				)
+			);
+			mask = _mm256_and_pd(mask, better);
+
+			best_fy = _mm256_blendv_pd(best_fy, fy, mask);
+			best_fx = _mm256_blendv_pd(best_fx, fx, mask);
+			best_fz = _mm256_blendv_pd(best_fz, fz, mask);
+			best_key = _mm256_blendv_pd(best_key, key, mask);
+		};
+
+		BOXOLOGIC_TARGET_AVX2 void reduce(__m256d fy, __m256d fx, __m256d fz, __m256d key, BoxFit &fit) const
+		{
+			double fys[4], fxs[4], fzs[4], keys[4];
+			_mm256_storeu_pd(fys, fy);
+			_mm256_storeu_pd(fxs, fx);
+			_mm256_storeu_pd(fzs, fz);
+			_mm256_storeu_pd(keys, key);
+
+			double best_key = -1;
+			for (size_t l = 0; l < 4; l++)
+			{
+				if (keys[l] < 0)
+					continue;
+
+				bool better = fys[l] < fit.fy || (fys[l] == fit.fy && (fxs[l] < fit.fx || (fxs[l] == fit.fx &&
+					(fzs[l] < fit.fz || (fzs[l] == fit.fz && keys[l] < best_key)))));
+				if (better == false)
+					continue;
+
+				fit.fy = fys[l];
+				fit.fx = fxs[l];
+				fit.fz = fzs[l];
+				best_key = keys[l];
+			}
+
+			if (best_key < 0)
+				return;
+
+			size_t index = (size_t)best_key / 6;
+			size_t o = (size_t)best_key % 6;
+			size_t t = box_types[index];
+
+			fit.index = index;
+			fit.x = dims[o][0][t];
+			fit.y = dims[o][1][t];
+			fit.z = dims[o][2][t];
+		};
+#endif
+	};
+};
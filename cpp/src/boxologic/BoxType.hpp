@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace boxologic
+{
+	/**
+	 * @brief A type of boxes, having same dimensions.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	struct BoxType
+	{
+	public:
+		/**
+		 * @brief Dimensions of the type.
+		 */
+		double width, height, length;
+
+		/**
+		 * @brief Indices of the boxes, in ascending order.
+		 */
+		std::vector<size_t> indices;
+
+		/**
+		 * @brief Number of boxes not packed yet.
+		 *
+		 * @details Boxes are packed in order of #indices; the not packed are the last ones.
+		 */
+		size_t remaining;
+
+		/**
+		 * @brief Index of the first box not packed yet.
+		 */
+		auto front() const -> size_t
+		{
+			return indices[indices.size() - remaining];
+		};
+	};
+};
@@ -2,15 +2,19 @@
 
 #include <boxologic/Pallet.hpp>
 #include <boxologic/Box.hpp>
+#include <boxologic/BoxTable.hpp>
+#include <boxologic/Skyline.hpp>
 
 #include <algorithm>
 #include <vector>
-#include <list>
 #include <map>
 #include <memory>
+#include <atomic>
 
 #include <bws/packer/Wrapper.hpp>
 #include <bws/packer/InstanceArray.hpp>
+#include <bws/packer/InstanceTable.hpp>
+#include <bws/packer/PackingEngine.hpp>
 
 /**
  * @brief A set of programs that calculate the best fit for boxes on a pallet migrated from language C. </p>
@@ -24,28 +28,6 @@
  */
 namespace boxologic
 {
-	/**
-	 * @brief Cumulated lengths of a layer.	
-	 * 
-	 * @details Scrapped represents an edge of a layer under construction.
-	 * 
-	 * @author Bill Knechtel, <br>
-	 *		   Migrated and Refactored by Jeongho Nam <http://samchon.org>
-	 */
-	struct Scrappad
-	{
-	public:
-		/**
-		 * @brief Cumulated length on the X-axis in 3D.
-		 */
-		double cumx;
-
-		/**
-		 * @brief Cumulated length on the Z-axis in 3D.
-		 */
-		double cumz;
-	};
-
 	/**
 	 * @brief A facade class of boxologic.
 	 * @details The boloxogic class deducts the best solution of packing boxes to a pallet.
@@ -58,6 +40,7 @@ namespace boxologic
 	 *		   Migrated and Refactored by Jeongho Nam <http://samchon.org>
 	 */
 	class Boxologic
+		: public bws::packer::PackingEngine
 	{
 	private:
 		/* ===========================================================
@@ -78,6 +61,16 @@ namespace boxologic
 		 */
 		std::shared_ptr<bws::packer::InstanceArray> leftInstances;
 
+		/**
+		 * Distinct instances, when instances are given by their SKU ids.
+		 */
+		std::shared_ptr<bws::packer::InstanceTable> instanceTable;
+
+		/**
+		 * SKU ids of instances trying to pack into the wrapper. Instances failed to pack, after decode().
+		 */
+		std::vector<uint32_t> *skus;
+
 		/* ===========================================================
 			BACKGROUND DATA
 				- STRUCTURES
@@ -101,6 +94,13 @@ namespace boxologic
 		 */
 		std::vector<struct Box> box_array;
 
+		/**
+		 * @brief Dimensions and packed flags of the #box_array, in structure of arrays.
+		 *
+		 * @see find_box
+		 */
+		BoxTable box_table;
+
 		/**
 		 * Sum of all boxes' volume.
 		 */
@@ -137,14 +137,23 @@ namespace boxologic
 		 * </ul>
 		 */
 		std::map<double, double> layer_map;
+
+		/**
+		 * @brief Evaluation values of all different lengths of {@link box_array all box} dimensions.
+		 *
+		 * @details Boxes are not changed by orientation of the #pallet. Thus evaluation values are computed
+		 *			once in encode() and shared by the #layer_map of each orientation.
+		 */
+		std::map<double, double> layer_evals;
 		
 		/**
 		 * @brief List of Scrapped instances, edges of layers under construction.
 		 *
+		 * @see Skyline
 		 * @see Scrapped
 		 * @see #scrap_min_z
 		 */
-		std::list<struct Scrappad> scrap_list;
+		Skyline scrap_list;
 
 		/**
 		 * @brief The topology Scrapped, the edge of the current layer under construction.
@@ -152,7 +161,7 @@ namespace boxologic
 		 * @see Scrapped
 		 * @see #scrap_list
 		 */
-		std::list<struct Scrappad>::iterator scrap_min_z;
+		Skyline::iterator scrap_min_z;
 
 		/* -----------------------------------------------------------
 			VARIABLES FOR ITERATIONS
@@ -243,9 +252,6 @@ namespace boxologic
 		double bboxy;
 		double bboxz;
 
-		double bfx, bfy, bfz;
-		double bbfx, bbfy, bbfz;
-
 		/* -----------------------------------------------------------
 			FLAGS FOR TERMINATING ITERATION
 		----------------------------------------------------------- */
@@ -266,11 +272,6 @@ namespace boxologic
 		 */
 		bool evened;
 
-		/**
-		 * Whether the best solution is deducted.
-		 */
-		bool packing_best;
-
 		/**
 		 * Whether the utilization degree of pallet space is 100%.
 		 */
@@ -291,6 +292,16 @@ namespace boxologic
 		 */
 		double best_solution_volume;
 
+		/**
+		 * @brief Placements of the best solution, the #box_array of the best trial.
+		 */
+		std::vector<struct Box> best_box_array;
+
+		/**
+		 * @brief Packed flags of the best solution, the #box_table of the best trial.
+		 */
+		BoxTable best_box_table;
+
 	public:
 		/* ===========================================================
 			CONSTRUCTORS
@@ -299,6 +310,21 @@ namespace boxologic
 		==============================================================
 			CONSTRUCTOR
 		----------------------------------------------------------- */
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * @details
+		 * <p> Constructs a reusable engine. Wrapper and instances are given by pack(wrapper, instanceArray). </p>
+		 *
+		 * <p> Buffers of the engine (boxes, layers, scraps and so on) are not freed after packing, but reset and
+		 * reused by the next packing. Thus an engine owned by a thread avoids allocations of repeated packings.
+		 * </p>
+		 */
+		Boxologic()
+		{
+			skus = nullptr;
+		};
+
 		/**
 		 * Construct from a wrapper and instances.
 		 *
@@ -309,10 +335,10 @@ namespace boxologic
 		{
 			this->wrapper = wrapper;
 			this->instanceArray = instanceArray;
-			this->leftInstances = std::make_shared<bws::packer::InstanceArray>();
+			this->skus = nullptr;
 		};
 		
-		~Boxologic()
+		virtual ~Boxologic()
 		{
 		};
 
@@ -333,19 +359,54 @@ namespace boxologic
 			pallet.height = wrapper->getContainableHeight();
 			pallet.length = wrapper->getContainableLength();
 
-			box_array.assign(instanceArray->size(), struct Box());
 			layer_map.clear();
 
-			for (size_t i = 0; i < instanceArray->size(); i++)
+			if (instanceTable != nullptr)
 			{
-				std::shared_ptr<bws::packer::Instance> instance = instanceArray->at(i);
+				// BY SKU IDS
+				box_array.assign(skus->size(), Box());
 
-				box_array[i].width = instance->getWidth();
-				box_array[i].height = instance->getHeight();
-				box_array[i].length = instance->getLength();
+				for (size_t i = 0; i < skus->size(); i++)
+				{
+					const bws::packer::InstanceTable::Record &record = instanceTable->at(skus->at(i));
+
+					box_array[i].width = record.width;
+					box_array[i].height = record.height;
+					box_array[i].length = record.length;
 
-				box_array[i].volume = instance->getVolume();
-				box_array[i].is_packed = false;
+					box_array[i].volume = record.volume;
+				}
+				box_table.assign(box_array, *skus);
+			}
+			else
+			{
+				box_array.assign(instanceArray->size(), Box());
+
+				for (size_t i = 0; i < instanceArray->size(); i++)
+				{
+					const std::shared_ptr<bws::packer::Instance> &instance = instanceArray->at(i);
+
+					box_array[i].width = instance->getWidth();
+					box_array[i].height = instance->getHeight();
+					box_array[i].length = instance->getLength();
+
+					box_array[i].volume = instance->getVolume();
+				}
+				box_table.assign(box_array);
+			}
+
+			// EVALUATE ALL LAYERS; ABOUT ALL BOXES, FIND THE MINIMUM LENGTH OF GAP ~,
+			// THE BOX ITSELF HAS NO GAP, SO THAT INCLUDING IT IS SAME WITH EXCLUDING IT
+			layer_evals.clear();
+
+			for (size_t i = 0; i < box_table.get_types().size(); i++)
+			{
+				const BoxType &type = box_table.get_types()[i];
+				double dims[3] = { type.width, type.height, type.length };
+
+				for (size_t j = 0; j < 3; j++)
+					if (layer_evals.count(dims[j]) == 0)
+						layer_evals[dims[j]] = box_table.evaluate_layer(dims[j]);
 			}
 
 			// INITIALIZE
@@ -355,10 +416,11 @@ namespace boxologic
 			for (size_t x = 0; x < box_array.size(); x++)
 				total_box_volume = total_box_volume + box_array[x].volume;
 
-			scrap_list.emplace_back();
+			scrap_list.clear();
+			scrap_list.push_back(Scrappad());
 
 			best_solution_volume = 0.0;
-			packing_best = false;
+			best_orientation = 0;
 			hundred_percent = false;
 		};
 
@@ -371,14 +433,19 @@ namespace boxologic
 		void decode()
 		{
 			wrapper->clear();
-			leftInstances->clear();
+			if (instanceTable == nullptr)
+				leftInstances = std::make_shared<bws::packer::InstanceArray>();
+
+			size_t lefts = 0;
 
 			for (size_t i = 0; i < box_array.size(); i++)
 			{
 				const Box &box = box_array[i];
-				std::shared_ptr<bws::packer::Instance> instance = instanceArray->at(i);
+				const std::shared_ptr<bws::packer::Instance> &instance = (instanceTable == nullptr)
+					? instanceArray->at(i)
+					: instanceTable->getInstance(skus->at(i));
 
-				if (box.is_packed == true)
+				if (box_table.is_packed(i) == true)
 				{
 					bws::packer::Wrap *wrap = new bws::packer::Wrap(wrapper.get(), instance, box.cox, box.coy, box.coz);
 					wrap->estimateOrientation(box.layout_width, box.layout_height, box.layout_length);
@@ -397,9 +464,15 @@ namespace boxologic
 				else
 				{
 					// NOT WRAPED INSTANCES BY LACK OF VOLUME
-					leftInstances->push_back(instance);
+					if (instanceTable == nullptr)
+						leftInstances->push_back(instance);
+					else
+						skus->at(lefts++) = skus->at(i);
 				}
 			}
+
+			if (instanceTable != nullptr)
+				skus->resize(lefts);
 		};
 
 	public:
@@ -437,17 +510,84 @@ namespace boxologic
 
 			decode();
 
-			return{ wrapper, leftInstances };
+			// RELEASE PARAMETERS, BUT KEEP BUFFERS
+			std::pair<std::shared_ptr<bws::packer::Wrapper>, std::shared_ptr<bws::packer::InstanceArray>> ret(wrapper, leftInstances);
+			wrapper = nullptr;
+			instanceArray = nullptr;
+			leftInstances = nullptr;
+
+			return ret;
+		};
+
+		/**
+		 * <p> Pack instances to a wrapper. </p>
+		 *
+		 * <p> Reuses this engine for the new parameters. Buffers of the previous packing are reused. </p>
+		 *
+		 * @param wrapper A wrapper to pack instances.
+		 * @param instanceArray Instances trying to pack into the wrapper.
+		 *
+		 * @return A pair of #wrapper with packed instances and
+		 *		   {@link leftInstances instances failed to pack} by overloading.
+		 */
+		virtual auto pack(std::shared_ptr<bws::packer::Wrapper> wrapper, std::shared_ptr<bws::packer::InstanceArray> instanceArray)
+			-> std::pair<std::shared_ptr<bws::packer::Wrapper>, std::shared_ptr<bws::packer::InstanceArray>> override
+		{
+			this->wrapper = wrapper;
+			this->instanceArray = instanceArray;
+
+			return pack();
+		};
+
+		/**
+		 * <p> Pack instances, given by their SKU ids, to a wrapper. </p>
+		 *
+		 * <p> Same with pack(wrapper, instanceArray), but the instances are represented by an array of SKU ids
+		 * in the <i>instanceTable</i>. Ids of instances failed to pack are left in the <i>skus</i>. </p>
+		 *
+		 * @param wrapper A wrapper to pack instances.
+		 * @param instanceTable Distinct instances.
+		 * @param skus SKU ids of instances trying to pack into the wrapper. After packing, SKU ids of
+		 *			   {@link leftInstances instances failed to pack} by overloading.
+		 *
+		 * @return The #wrapper with packed instances.
+		 */
+		virtual auto pack(std::shared_ptr<bws::packer::Wrapper> wrapper, std::shared_ptr<bws::packer::InstanceTable> instanceTable, std::vector<uint32_t> &skus)
+			-> std::shared_ptr<bws::packer::Wrapper> override
+		{
+			this->wrapper = wrapper;
+			this->instanceTable = instanceTable;
+			this->skus = &skus;
+
+			std::shared_ptr<bws::packer::Wrapper> ret = pack().first;
+			this->instanceTable = nullptr;
+			this->skus = nullptr;
+
+			return ret;
 		};
 
 	private:
 		/**
 		 * @brief Execute iterations by calling proper functions.
 		 *
-		 * @details Iterations are done and parameters of the best solution are found.
+		 * @details
+		 * <p> Iterations are done and parameters of the best solution are found. </p>
+		 *
+		 * <p> Each pair of pallet orientation and layer thickness is a trial independent of others. Trials are
+		 * iterated in parallel, by Boxologic objects of each thread having their own boxes, scraps and counters,
+		 * which are reset by fetch_trial() and reused for following trials and packings. The
+		 * best trial is the one packing the largest volume, and the former one in a tie, so that the result
+		 * is same with iterating trials in order. When a trial utilizes all of the space, trials after it are
+		 * skipped; they cannot be better. </p>
+		 *
+		 * <p> When the {@link bws::packer::CancelToken cancel token} is expired, trials not begun yet are
+		 * skipped, except the first one; the best of the tried ones is taken. </p>
 		 */
 		void iterate_orientations() //TODO: Needs a better name yet
 		{
+			// LIST UP TRIALS; PAIRS OF ORIENTATION AND LAYER
+			std::vector<std::pair<int, double>> trials;
+
 			for (int orientation = 1; orientation <= 6; orientation++)
 			{
 				pallet.set_orientation(orientation);
@@ -455,31 +595,73 @@ namespace boxologic
 				// CONSTRUCT LAYERS
 				construct_layers();
 
-				// ITERATION IN LAYERS
 				for (auto it = layer_map.begin(); it != layer_map.end(); it++)
+					trials.emplace_back(orientation, it->first);
+
+				// IF THE PALLET IS REGULAR CUBE,
+				if (pallet.width == pallet.height && pallet.height == pallet.length)
+					break; // DON'T ITERATE ALL ORIENTATIONS
+			}
+
+			// INDEX OF THE FIRST TRIAL UTILIZED ALL
+			std::atomic<int> hundred_index((int)trials.size());
+			int best_index = (int)trials.size();
+
+			#pragma omp parallel for schedule(dynamic) if(trials.size() > 1)
+			for (int i = 0; i < (int)trials.size(); i++)
+			{
+				if (i > hundred_index)
+					continue; // SUCCESS TO UTILIZE ALL IN A FORMER TRIAL
+				else if (i != 0 && cancelToken != nullptr && cancelToken->isExpired() == true)
+					continue; // CANCELED, BUT THE FIRST TRIAL IS REQUIRED
+
+				// BEGINS PACKING, BY THE THREAD'S OWN TRIAL
+				static thread_local Boxologic trial;
+				trial.fetch_trial(*this);
+				trial.pallet.set_orientation(trials[i].first);
+				trial.iterate_layer(trials[i].second);
+
+				if (trial.hundred_percent)
 				{
-					// BEGINS PACKING
-					iterate_layer(it->first);
+					int index = hundred_index;
+					while (i < index && hundred_index.compare_exchange_weak(index, i) == false)
+						continue;
+				}
 
-					if (packed_volume > best_solution_volume)
+				#pragma omp critical
+				{
+					if (trial.packed_volume > best_solution_volume
+						|| (trial.packed_volume == best_solution_volume && i < best_index))
 					{
 						// NEW VOLUME IS THE BEST
-						best_solution_volume = packed_volume;
-						best_orientation = orientation;
-						best_layer = it->first;
-					}
+						best_solution_volume = trial.packed_volume;
+						best_orientation = trials[i].first;
+						best_layer = trials[i].second;
+						best_index = i;
 
-					if (hundred_percent)
-						break; // SUCCESS TO UTILIZE ALL
+						best_box_array = trial.box_array;
+						best_box_table = trial.box_table;
+					}
 				}
+			}
+		};
 
-				if (hundred_percent)
-					break; // SUCCESS TO UTILIZE ALL
+		/**
+		 * @brief Fetch a trial from a Boxologic.
+		 *
+		 * @details Copies states required by a trial, the #pallet, boxes and scraps, reusing buffers.
+		 *
+		 * @param obj The Boxologic iterating trials.
+		 */
+		void fetch_trial(const Boxologic &obj)
+		{
+			pallet = obj.pallet;
+			box_array = obj.box_array;
+			box_table = obj.box_table;
+			scrap_list = obj.scrap_list;
 
-						   // IF THE PALLET IS REGULAR CUBE,
-				if (pallet.width == pallet.height && pallet.height == pallet.length)
-					orientation = 6; // DON'T ITERATE ALL ORIENTATIONS
-			}
+			total_box_volume = obj.total_box_volume;
+			hundred_percent = false;
 		};
 
 		/**
@@ -501,8 +683,7 @@ namespace boxologic
 			remain_layout_length = pallet.layout_length;
 
 			// UNPACK ALL BOXES
-			for (size_t i = 0; i < box_array.size(); i++)
-				box_array[i].is_packed = false;
+			box_table.unpack_all();
 
 			do
 			{
@@ -554,9 +735,11 @@ namespace boxologic
 		{
 			layer_map.clear();
 
-			for (size_t i = 0; i < box_array.size(); i++)
+			const std::vector<BoxType> &types = box_table.get_types();
+
+			for (size_t i = 0; i < types.size(); i++)
 			{
-				const struct Box &box = box_array[i];
+				const BoxType &type = types[i];
 
 				for (size_t j = 1; j <= 3; j++)
 				{
@@ -564,25 +747,23 @@ namespace boxologic
 					double dimen2; // THE SECOND, LENGTH ON A RESIDUAL DIMENSION
 					double dimen3; // THE THIRD, LENGTH ON A RESIDUAL DIMENSION
 
-					double layer_eval = 0; // SUM OF LAYERS (height)
-
 					// FETCH STANDARD DIMENSIONS FROM EACH AXIS
 					switch (j)
 					{
 					case 1:
-						ex_dim = box.width;
-						dimen2 = box.height;
-						dimen3 = box.length;
+						ex_dim = type.width;
+						dimen2 = type.height;
+						dimen3 = type.length;
 						break;
 					case 2:
-						ex_dim = box.height;
-						dimen2 = box.width;
-						dimen3 = box.length;
+						ex_dim = type.height;
+						dimen2 = type.width;
+						dimen3 = type.length;
 						break;
 					case 3:
-						ex_dim = box.length;
-						dimen2 = box.width;
-						dimen3 = box.height;
+						ex_dim = type.length;
+						dimen2 = type.width;
+						dimen3 = type.height;
 						break;
 					}
 
@@ -601,28 +782,8 @@ namespace boxologic
 					if (layer_map.count(ex_dim) != 0)
 						continue;
 
-					// ABOUT ALL BOXES, FIND THE MINIMUM LENGTH OF GAP ~,
-					// STACK ON THE CURRENT LAYER (ADD ON TO THE LAYER_EVAL)
-					for (size_t k = 0; k < box_array.size(); k++)
-					{
-						// SAME INSTANCE WITH THE SAME INDEX
-						if (i == k)
-							continue;
-
-						const struct Box &my_box = box_array[k];
-						double dim_diff = 
-							std::min
-							({
-								abs(ex_dim - my_box.width),
-								abs(ex_dim - my_box.height),
-								abs(ex_dim - my_box.length)
-							});
-
-						layer_eval += dim_diff;
-					}
-
-					// RECORD THE SUM
-					layer_map[ex_dim] = layer_eval;
+					// RECORD THE SUM, EVALUATED IN ENCODE()
+					layer_map[ex_dim] = layer_evals[ex_dim];
 				}
 			}
 		};
@@ -644,8 +805,8 @@ namespace boxologic
 
 			double lenx, lenz, lpz;
 
-			scrap_list.begin()->cumx = pallet.layout_width;
-			scrap_list.begin()->cumz = 0;
+			scrap_list.set_cumx(scrap_list.begin(), pallet.layout_width);
+			scrap_list.set_cumz(scrap_list.begin(), 0);
 
 			while (true)
 			{
@@ -653,8 +814,8 @@ namespace boxologic
 				find_smallest_z();
 
 				// FETCH LEFT AND RIGHT OF SCRAP_MIN_Z
-				auto &prev = fetch_scrap_min_z_left();
-				auto &next = fetch_scrap_min_z_right();
+				auto prev = fetch_scrap_min_z_left();
+				auto next = fetch_scrap_min_z_right();
 
 				if (scrap_min_z == scrap_list.end())
 				{
@@ -686,7 +847,7 @@ namespace boxologic
 					if (cbox_layout_width == scrap_min_z->cumx)
 					{
 						// CUMULATE
-						scrap_min_z->cumz += cbox_layout_length;
+						scrap_list.set_cumz(scrap_min_z, scrap_min_z->cumz + cbox_layout_length);
 					}
 					else
 					{
@@ -742,7 +903,7 @@ namespace boxologic
 						else
 						{
 							// CUMULATE
-							scrap_min_z->cumz += cbox_layout_length;
+							scrap_list.set_cumz(scrap_min_z, scrap_min_z->cumz + cbox_layout_length);
 						}
 					}
 					else
@@ -752,12 +913,12 @@ namespace boxologic
 						if (scrap_min_z->cumz + cbox_layout_length == next->cumz)
 						{
 							// DE-CUMULATE
-							scrap_min_z->cumx -= cbox_layout_width;
+							scrap_list.set_cumx(scrap_min_z, scrap_min_z->cumx - cbox_layout_width);
 						}
 						else
 						{
 							// UPDATE MIN_Z
-							scrap_min_z->cumx -= cbox_layout_width;
+							scrap_list.set_cumx(scrap_min_z, scrap_min_z->cumx - cbox_layout_width);
 
 							// CREATE A NEW NODE BETWEEN MIN_Z AND RIGHT
 							struct Scrappad scrap =
@@ -801,7 +962,7 @@ namespace boxologic
 						if (scrap_min_z->cumz + cbox_layout_length == prev->cumz)
 						{
 							// LEFT FETCHES MIN_Z'S CUM_X
-							prev->cumx = scrap_min_z->cumx;
+							scrap_list.set_cumx(prev, scrap_min_z->cumx);
 
 							// ERASE FROM MIN_Z TO END
 							scrap_min_z = scrap_list.erase(scrap_min_z, scrap_list.end());
@@ -809,7 +970,7 @@ namespace boxologic
 						else
 						{
 							// CUMULATE
-							scrap_min_z->cumz += cbox_layout_length;
+							scrap_list.set_cumz(scrap_min_z, scrap_min_z->cumz + cbox_layout_length);
 						}
 					}
 					else
@@ -817,7 +978,7 @@ namespace boxologic
 						if (scrap_min_z->cumz + cbox_layout_length == prev->cumz)
 						{
 							// CUMULATE
-							prev->cumx += cbox_layout_width;
+							scrap_list.set_cumx(prev, prev->cumx + cbox_layout_width);
 						}
 						else
 						{
@@ -866,7 +1027,7 @@ namespace boxologic
 						if (scrap_min_z->cumz + cbox_layout_length == next->cumz)
 						{
 							// LEFT FETCHES RIGHT'S CUM_X
-							prev->cumx = next->cumx;
+							scrap_list.set_cumx(prev, next->cumx);
 
 							// ERASE MIN_Z AND RIGHT
 							auto next_of_next = next;
@@ -877,7 +1038,7 @@ namespace boxologic
 						else
 						{
 							// CUMULATE
-							scrap_min_z->cumz += cbox_layout_length;
+							scrap_list.set_cumz(scrap_min_z, scrap_min_z->cumz + cbox_layout_length);
 						}
 					}
 					else if (prev->cumx < pallet.layout_width - scrap_min_z->cumx)
@@ -885,7 +1046,7 @@ namespace boxologic
 						if (scrap_min_z->cumz + cbox_layout_length == prev->cumz)
 						{
 							// DE-CUMULATE
-							scrap_min_z->cumx -= cbox_layout_width;
+							scrap_list.set_cumx(scrap_min_z, scrap_min_z->cumx - cbox_layout_width);
 							box.cox = scrap_min_z->cumx;
 						}
 						else
@@ -906,7 +1067,7 @@ namespace boxologic
 						if (scrap_min_z->cumz + cbox_layout_length == prev->cumz)
 						{
 							// CUMULATE
-							prev->cumx += cbox_layout_width;
+							scrap_list.set_cumx(prev, prev->cumx + cbox_layout_width);
 							box.cox = prev->cumx;
 						}
 						else
@@ -922,7 +1083,7 @@ namespace boxologic
 							scrap_list.insert(next, scrap);
 
 							// UPDATE MIN_Z
-							scrap_min_z->cumx -= cbox_layout_width;
+							scrap_list.set_cumx(scrap_min_z, scrap_min_z->cumx - cbox_layout_width);
 						}
 					}
 				}
@@ -959,7 +1120,7 @@ namespace boxologic
 						if (scrap_min_z->cumz + cbox_layout_length == prev->cumz)
 						{
 							// LEFT FETCHES MIN_Z'S
-							prev->cumx = scrap_min_z->cumx;
+							scrap_list.set_cumx(prev, scrap_min_z->cumx);
 
 							// ERASE MIN_Z
 							scrap_min_z = scrap_list.erase(scrap_min_z);
@@ -967,7 +1128,7 @@ namespace boxologic
 						else
 						{
 							// CUMULATE
-							scrap_min_z->cumz += cbox_layout_length;
+							scrap_list.set_cumz(scrap_min_z, scrap_min_z->cumz + cbox_layout_length);
 						}
 					}
 					else
@@ -975,12 +1136,12 @@ namespace boxologic
 						if (scrap_min_z->cumz + cbox_layout_length == prev->cumz)
 						{
 							// CUMULATE
-							prev->cumx += cbox_layout_width;
+							scrap_list.set_cumx(prev, prev->cumx + cbox_layout_width);
 						}
 						else if (scrap_min_z->cumz + cbox_layout_length == next->cumz)
 						{
 							// DE-CUMULATE
-							scrap_min_z->cumx -= cbox_layout_width;
+							scrap_list.set_cumx(scrap_min_z, scrap_min_z->cumx - cbox_layout_width);
 							box.cox = scrap_min_z->cumx;
 						}
 						else
@@ -1010,40 +1171,44 @@ namespace boxologic
 		{
 			// MINIMUM SUM OF LAYERS (height)
 			double min_eval = INT_MAX;
+			size_t min_index = (size_t)-1;
 	
 			layer_thickness = 0;
 
-			for (size_t i = 0; i < box_array.size(); i++)
+			const std::vector<BoxType> &types = box_table.get_types();
+
+			for (size_t i = 0; i < types.size(); i++)
 			{
-				const struct Box &box = box_array[i];
-				if (box.is_packed) 
+				const BoxType &type = types[i];
+				if (type.remaining == 0)
 					continue;
 
+				// BOXES OF A TYPE ARE IDENTICAL; THE FIRST REMAINED ONE REPRESENTS THEM
+				size_t index = type.front();
+
 				for (size_t j = 1; j  <= 3; j++)
 				{
 					double ex_dim; // STANDARD LENGTH ON THE DIMENSION
 					double dim2; // THE SECOND, LENGTH ON A RESIDUAL DIMENSION
 					double dim3; // THE THIRD, LENGTH ON A RESIDUAL DIMENSION
 
-					double my_eval = 0;
-
 					// FETCH STANDARD DIMENSIONS FROM EACH AXIS
 					switch (j)
 					{
 					case 1:
-						ex_dim = box.width;
-						dim2 = box.height;
-						dim3 = box.length;
+						ex_dim = type.width;
+						dim2 = type.height;
+						dim3 = type.length;
 						break;
 					case 2:
-						ex_dim = box.height;
-						dim2 = box.width;
-						dim3 = box.length;
+						ex_dim = type.height;
+						dim2 = type.width;
+						dim3 = type.length;
 						break;
 					case 3:
-						ex_dim = box.length;
-						dim2 = box.width;
-						dim3 = box.height;
+						ex_dim = type.length;
+						dim2 = type.width;
+						dim3 = type.height;
 						break;
 					}
 
@@ -1057,26 +1222,13 @@ namespace boxologic
 							)
 						)
 					{
-						for (size_t k = 0; k < box_array.size(); k++)
-						{
-							const struct Box &my_box = box_array[k];
-
-							// SAME INSTANCE WITH THE SAME INDEX OR ALREADY PACKED
-							if (i == k || my_box.is_packed == true)
-								continue;
-
-							double dim_diff =
-								std::min
-								({
-									abs(ex_dim - my_box.width),
-									abs(ex_dim - my_box.height),
-									abs(ex_dim - my_box.length)
-								});
-							my_eval += dim_diff;
-						}
-						if (my_eval < min_eval)
+						double my_eval = box_table.evaluate_layer(ex_dim);
+
+						// THE FORMER BOX IN A TIE
+						if (my_eval < min_eval || (my_eval == min_eval && min_index != (size_t)-1 && index < min_index))
 						{
 							min_eval = my_eval;
+							min_index = index;
 							layer_thickness = ex_dim;
 						}
 					}
@@ -1100,92 +1252,20 @@ namespace boxologic
 		 */
 		void find_box(double hmx, double hy, double hmy, double hz, double hmz)
 		{
-			boxi = -1;
-			bboxi = -1;
+			BoxFit within;
+			BoxFit beyond;
 
-			bfx = INT_MAX;
-			bfy = INT_MAX;
-			bfz = INT_MAX;
-			bbfx = INT_MAX;
-			bbfy = INT_MAX;
-			bbfz = INT_MAX;
+			box_table.find(hmx, hy, hmy, hz, hmz, within, beyond);
 
-			for (size_t i = 0; i < box_array.size(); i++)
-			{
-				const struct Box &box = box_array[i];
-				if (box.is_packed)
-					continue;
-
-				analyze_box(i, hmx, hy, hmy, hz, hmz, box.width, box.height, box.length);
+			boxi = within.index;
+			boxx = within.x;
+			boxy = within.y;
+			boxz = within.z;
 
-				// WHEN REGULAR CUBE
-				if (box.width == box.length && box.length == box.height)
-					continue;
-
-				analyze_box(i, hmx, hy, hmy, hz, hmz, box.width, box.length, box.height);
-				analyze_box(i, hmx, hy, hmy, hz, hmz, box.height, box.width, box.length);
-				analyze_box(i, hmx, hy, hmy, hz, hmz, box.height, box.length, box.width);
-				analyze_box(i, hmx, hy, hmy, hz, hmz, box.length, box.width, box.height);
-				analyze_box(i, hmx, hy, hmy, hz, hmz, box.length, box.height, box.width);
-			}
-		};
-
-		/**
-		 * @brief Analyzes each unpacked Box to find the best fitting one to the empty space.
-		 * 
-		 * @details Used by #find_box() to analyze box dimensions.
-		 *
-		 * @param index Index of a Box in the #box_array.
-		 * 
-		 * @param hmx Maximum available x-dimension of the current gap to be filled.
-		 * @param hy Current layer thickness value.
-		 * @param hmy Current layer thickness value.
-		 * @param hz Z-dimension of the current gap to be filled.
-		 * @param hmz Maximum available z-dimension to the current gap to be filled.
-		 *
-		 * @param dim1 X-dimension of the orientation of the box being examined.
-		 * @param dim2 Y-dimension of the orientation of the box being examined.
-		 * @param dim3 Z-dimension of the orientation of the box being examined.
-		 */
-		void analyze_box(size_t index, double hmx, double hy, double hmy, double hz, double hmz, double dim1, double dim2, double dim3)
-		{
-			// OUT OF BOUNDARY RANGE
-			if (dim1 > hmx || dim2 > hmy || dim3 > hmz)
-				return;
-
-			if (dim2 <= hy && 
-					(
-						hy - dim2 < bfy ||
-						(hy - dim2 == bfy && hmx - dim1 < bfx) ||
-						(hy - dim2 == bfy && hmx - dim1 == bfx && abs(hz - dim3) < bfz)
-					)
-				)
-			{
-				boxx = dim1;
-				boxy = dim2;
-				boxz = dim3;
-				bfx = hmx - dim1;
-				bfy = hy - dim2;
-				bfz = abs(hz - dim3);
-				boxi = index;
-			}
-			else if 
-				(dim2 > hy &&
-					(
-						dim2 - hy < bbfy ||
-						(dim2 - hy == bbfy && hmx - dim1 < bbfx) ||
-						(dim2 - hy == bbfy && hmx - dim1 == bbfx && abs(hz - dim3) < bbfz)
-					)
-				)
-			{
-				bboxx = dim1;
-				bboxy = dim2;
-				bboxz = dim3;
-				bbfx = hmx - dim1;
-				bbfy = dim2 - hy;
-				bbfz = abs(hz - dim3);
-				bboxi = index;
-			}
+			bboxi = beyond.index;
+			bboxx = beyond.x;
+			bboxy = beyond.y;
+			bboxz = beyond.z;
 		};
 
 		/* -----------------------------------------------------------
@@ -1208,8 +1288,8 @@ namespace boxologic
 			}
 			else
 			{
-				auto &prev = fetch_scrap_min_z_left();
-				auto &next = fetch_scrap_min_z_right();
+				auto prev = fetch_scrap_min_z_left();
+				auto next = fetch_scrap_min_z_right();
 
 				if (bboxi != (size_t)-1 && // IN RANGE
 					(
@@ -1268,7 +1348,7 @@ namespace boxologic
 							///////////////////////////////////////////
 							// ERASE CURRENT SCRAP_MIN_Z
 							// THE LEFT ITEM FETCHES MIN'S CUM_X
-							prev->cumx = scrap_min_z->cumx;
+							scrap_list.set_cumx(prev, scrap_min_z->cumx);
 
 							// ERASE FROM MIN_Z TO END
 							scrap_min_z = scrap_list.erase(scrap_min_z, scrap_list.end());
@@ -1284,7 +1364,7 @@ namespace boxologic
 								// LEFT AND RIGHT'S CUM_Z ARE EQUAL
 								// ----------------------------------------
 								// LEFT FETCHES THE RIGHT'S CUM_X
-								prev->cumx = next->cumx;
+								scrap_list.set_cumx(prev, next->cumx);
 
 								// ERASE MIN AND ITS RIGHT
 								auto next_of_next = next;
@@ -1298,7 +1378,7 @@ namespace boxologic
 								// LEFT AND RIGHT'S CUM_Z ARE NOT EQUAL
 								// ----------------------------------------
 								if (prev->cumz == next->cumz)
-									prev->cumx = scrap_min_z->cumx;
+									scrap_list.set_cumx(prev, scrap_min_z->cumx);
 
 								// ERASE SCRAP_MIN_Z
 								scrap_min_z = scrap_list.erase(scrap_min_z);
@@ -1316,20 +1396,14 @@ namespace boxologic
 		{
 			struct Box &box = box_array[cboxi];
 
-			box.is_packed = true;
+			box_table.pack(cboxi);
 			box.layout_width = cbox_layout_width;
 			box.layout_height = cbox_layout_height;
 			box.layout_length = cbox_layout_length;
 
 			packed_volume += box.volume;
 
-			if (packing_best)
-			{
-				// BOXOLOGIC DOESN'T MEMORIZE OPTIMIZED ORIENTATION
-				// THUS IT NEEDS ADDITIONAL PROCEDURES FOR EXPORTING
-				write_box_file();
-			}
-			else if (packed_volume == pallet.volume || packed_volume == total_box_volume)
+			if (packed_volume == pallet.volume || packed_volume == total_box_volume)
 			{
 				packing = false;
 				hundred_percent = true;
@@ -1339,7 +1413,7 @@ namespace boxologic
 		/* -----------------------------------------------------------
 			GETTERS
 		----------------------------------------------------------- */
-		auto fetch_scrap_min_z_left() -> std::list<struct Scrappad>::iterator
+		auto fetch_scrap_min_z_left() -> Skyline::iterator
 		{
 			if (scrap_min_z == scrap_list.begin())
 				return scrap_list.end();
@@ -1352,7 +1426,7 @@ namespace boxologic
 			}
 		};
 
-		auto fetch_scrap_min_z_right() -> std::list<struct Scrappad>::iterator
+		auto fetch_scrap_min_z_right() -> Skyline::iterator
 		{
 			auto it = scrap_min_z;
 			it++;
@@ -1367,11 +1441,7 @@ namespace boxologic
 		 */
 		void find_smallest_z()
 		{
-			scrap_min_z = scrap_list.begin();
-
-			for (auto it = scrap_list.begin(); it != scrap_list.end(); it++)
-				if (it->cumz < scrap_min_z->cumz)
-					scrap_min_z = it;
+			scrap_min_z = scrap_list.min();
 		};
 
 		/* -----------------------------------------------------------
@@ -1380,18 +1450,28 @@ namespace boxologic
 		/**
 		 * @brief Determine {@link #box_arrray boxes}.
 		 *
-		 * Using the parameters found, packs the best solution found and reports.
+		 * Fetches placements of the {@link best_box_array best trial} and reports.
 		 */
 		void report_results()
 		{
+			if (best_orientation == 0)
+			{
+				// NO TRIAL; NO BOX IS PACKED
+				box_table.unpack_all();
+				return;
+			}
+
 			////////////////////////////////////////////////////
-			// BEGINS RE-PACKING FOLLOWING THE BEST VARS
+			// FETCH PLACEMENTS OF THE BEST TRIAL
 			////////////////////////////////////////////////////
-			packing_best = true;
-
-			pallet.set_orientation(best_orientation);
-			construct_layers();
-			iterate_layer(best_layer);
+			box_array = best_box_array;
+			box_table = best_box_table;
+
+			// BOXOLOGIC DOESN'T MEMORIZE OPTIMIZED ORIENTATION
+			// THUS IT NEEDS ADDITIONAL PROCEDURES FOR EXPORTING
+			for (cboxi = 0; cboxi < box_array.size(); cboxi++)
+				if (box_table.is_packed(cboxi) == true)
+					write_box_file();
 		};
 
 		/**
@@ -0,0 +1,202 @@
+#pragma once
+#include <boxologic/BoxType.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+namespace boxologic
+{
+	/**
+	 * @brief An evaluator of layer thicknesses.
+	 *
+	 * @details
+	 * <p> Evaluation of a layer thickness is sum of minimum gaps between the thickness and dimensions of
+	 * each box: <i>F(x) = &Sigma; count * min(|x - width|, |x - height|, |x - length|)</i>. </p>
+	 *
+	 * <p> A gap of a box type is a piecewise linear function of <i>x</i>; with sorted dimensions
+	 * <i>a &lt;= b &lt;= c</i>, its slope changes at <i>a, (a+b)/2, b, (b+c)/2</i> and <i>c</i>, by +2 and
+	 * -2 alternately. LayerEvaluator sorts the breakpoints of all types once and stores their slope changes
+	 * in Fenwick trees, so that <i>F(x)</i> is computed by a binary search and prefix sums, in
+	 * O(log n), instead of iterating all of the boxes. </p>
+	 *
+	 * <p> The evaluation considers only boxes not packed yet. {@link remove Packing a box} updates the trees
+	 * in O(log n), too. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class LayerEvaluator
+	{
+	private:
+		/**
+		 * @brief Breakpoints of all types, in ascending order.
+		 */
+		std::vector<double> points;
+
+		/**
+		 * @brief Index of each type's breakpoints in #points.
+		 */
+		std::vector<std::vector<size_t>> positions;
+
+		/**
+		 * @brief Smallest dimension of each type.
+		 */
+		std::vector<double> smallests;
+
+		/**
+		 * @brief Fenwick tree of slope changes.
+		 */
+		std::vector<double> slopes;
+
+		/**
+		 * @brief Fenwick tree of slope changes multiplied by their breakpoints.
+		 */
+		std::vector<double> intercepts;
+
+		/**
+		 * @brief Number of remained boxes.
+		 */
+		double weight;
+
+		/**
+		 * @brief Sum of smallest dimensions of remained boxes.
+		 */
+		double smallest_sum;
+
+		/**
+		 * @brief Fenwick trees and sums when all boxes are remained, to be restored by reset().
+		 */
+		std::vector<double> base_slopes, base_intercepts;
+		double base_weight, base_smallest_sum;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Assign types of boxes.
+		 *
+		 * @details All boxes are remained.
+		 */
+		void assign(const std::vector<BoxType> &types)
+		{
+			std::vector<std::pair<double, size_t>> breakpoints; // (POINT, TYPE * 5 + ORDER)
+
+			std::vector<size_t> counts(types.size(), 0);
+			smallests.assign(types.size(), 0);
+
+			for (size_t t = 0; t < types.size(); t++)
+			{
+				double dims[3] = { types[t].width, types[t].height, types[t].length };
+				std::sort(dims, dims + 3);
+
+				double type_points[5] = { dims[0], (dims[0] + dims[1]) / 2, dims[1], (dims[1] + dims[2]) / 2, dims[2] };
+				for (size_t k = 0; k < 5; k++)
+					breakpoints.emplace_back(type_points[k], t * 5 + k);
+
+				smallests[t] = dims[0];
+				counts[t] = types[t].indices.size();
+			}
+			std::sort(breakpoints.begin(), breakpoints.end());
+
+			points.assign(breakpoints.size(), 0);
+			positions.assign(types.size(), std::vector<size_t>(5, 0));
+
+			for (size_t i = 0; i < breakpoints.size(); i++)
+			{
+				points[i] = breakpoints[i].first;
+				positions[breakpoints[i].second / 5][breakpoints[i].second % 5] = i;
+			}
+
+			// SLOPE CHANGES ON EACH BREAKPOINT
+			base_slopes.assign(points.size() + 1, 0);
+			base_intercepts.assign(points.size() + 1, 0);
+			base_weight = 0;
+			base_smallest_sum = 0;
+
+			for (size_t t = 0; t < counts.size(); t++)
+			{
+				for (size_t k = 0; k < 5; k++)
+				{
+					size_t i = positions[t][k] + 1;
+					double delta = (k % 2 == 0) ? +2.0 * counts[t] : -2.0 * counts[t];
+
+					base_slopes[i] += delta;
+					base_intercepts[i] += delta * points[i - 1];
+				}
+				base_weight += counts[t];
+				base_smallest_sum += counts[t] * smallests[t];
+			}
+
+			// BUILD FENWICK TREES IN LINEAR TIME
+			for (size_t i = 1; i < base_slopes.size(); i++)
+			{
+				size_t parent = i + (i & (~i + 1));
+				if (parent < base_slopes.size())
+				{
+					base_slopes[parent] += base_slopes[i];
+					base_intercepts[parent] += base_intercepts[i];
+				}
+			}
+			reset();
+		};
+
+		/**
+		 * @brief Mark all boxes as remained.
+		 */
+		void reset()
+		{
+			slopes = base_slopes;
+			intercepts = base_intercepts;
+			weight = base_weight;
+			smallest_sum = base_smallest_sum;
+		};
+
+		/**
+		 * @brief Mark a box of a type as packed.
+		 */
+		void remove(size_t type)
+		{
+			for (size_t k = 0; k < 5; k++)
+			{
+				double delta = (k % 2 == 0) ? -2.0 : +2.0;
+				double point = points[positions[type][k]];
+
+				for (size_t i = positions[type][k] + 1; i < slopes.size(); i += i & (~i + 1))
+				{
+					slopes[i] += delta;
+					intercepts[i] += delta * point;
+				}
+			}
+			weight -= 1;
+			smallest_sum -= smallests[type];
+		};
+
+		/* -----------------------------------------------------------
+			EVALUATOR
+		----------------------------------------------------------- */
+		/**
+		 * @brief Evaluate a layer thickness.
+		 *
+		 * @param thickness The layer thickness.
+		 * @return Sum of minimum gaps between the thickness and dimensions of remained boxes.
+		 */
+		auto evaluate(double thickness) const -> double
+		{
+			// BREAKPOINTS NOT GREATER THAN THE THICKNESS
+			size_t n = std::upper_bound(points.begin(), points.end(), thickness) - points.begin();
+
+			double slope = 0;
+			double intercept = 0;
+
+			for (size_t i = n; i > 0; i -= i & (~i + 1))
+			{
+				slope += slopes[i];
+				intercept += intercepts[i];
+			}
+
+			// F(x) = SUM(a - x) + SUM(delta * (x - point)), FOR POINT <= x
+			return (smallest_sum - weight * thickness) + (slope * thickness - intercept);
+		};
+	};
+};
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace boxologic
+{
+	/**
+	 * @brief Cumulated lengths of a layer.
+	 *
+	 * @details Scrapped represents an edge of a layer under construction.
+	 *
+	 * @author Bill Knechtel, <br>
+	 *		   Migrated and Refactored by Jeongho Nam <http://samchon.org>
+	 */
+	struct Scrappad
+	{
+	public:
+		/**
+		 * @brief Cumulated length on the X-axis in 3D.
+		 */
+		double cumx;
+
+		/**
+		 * @brief Cumulated length on the Z-axis in 3D.
+		 */
+		double cumz;
+	};
+
+	/**
+	 * @brief A skyline of {@link Scrappad scraps}, edges of a layer under construction.
+	 *
+	 * @details
+	 * <p> Skyline is a doubly linked list of Scrappad objects, of which nodes are pooled in a contiguous
+	 * array. Erased nodes are recycled by following insertions, so that the list doesn't allocate memory
+	 * after it has grown enough. </p>
+	 *
+	 * <p> Nodes are also indexed by a binary min-heap on (cumz, position in the list), so that the first
+	 * scrap having the smallest z, {@link min}, is found in O(1) and kept in O(log n) by each modification.
+	 * To keep the heap, modifications of scraps must be done by {@link set_cumx} and {@link set_cumz};
+	 * iterators give read-only access. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class Skyline
+	{
+	private:
+		static const size_t npos = (size_t)-1;
+
+		struct Node
+		{
+			Scrappad scrap;
+
+			size_t prev;
+			size_t next;
+
+			/**
+			 * @brief Label of position in the list; ascending from the front.
+			 */
+			double order;
+
+			/**
+			 * @brief Index in the heap.
+			 */
+			size_t heap;
+		};
+
+		/**
+		 * @brief Pool of nodes.
+		 */
+		std::vector<Node> nodes;
+
+		/**
+		 * @brief Indices of erased nodes in the pool, to be recycled.
+		 */
+		std::vector<size_t> garbages;
+
+		/**
+		 * @brief Indices of nodes, in order of binary min-heap.
+		 */
+		std::vector<size_t> heap;
+
+		size_t head;
+		size_t tail;
+
+	public:
+		/**
+		 * @brief Bidirectional iterator of the Skyline, with read-only access.
+		 */
+		class iterator
+		{
+			friend class Skyline;
+
+		private:
+			const Skyline *skyline;
+			size_t index;
+
+			iterator(const Skyline *skyline, size_t index)
+			{
+				this->skyline = skyline;
+				this->index = index;
+			};
+
+		public:
+			iterator()
+				: iterator(nullptr, npos)
+			{
+			};
+
+			auto operator*() const -> const Scrappad&
+			{
+				return skyline->nodes[index].scrap;
+			};
+			auto operator->() const -> const Scrappad*
+			{
+				return &skyline->nodes[index].scrap;
+			};
+
+			auto operator++() -> iterator&
+			{
+				index = skyline->nodes[index].next;
+				return *this;
+			};
+			auto operator--() -> iterator&
+			{
+				index = (index == npos) ? skyline->tail : skyline->nodes[index].prev;
+				return *this;
+			};
+			auto operator++(int) -> iterator
+			{
+				iterator it = *this;
+				++*this;
+
+				return it;
+			};
+			auto operator--(int) -> iterator
+			{
+				iterator it = *this;
+				--*this;
+
+				return it;
+			};
+
+			auto operator==(const iterator &obj) const -> bool
+			{
+				return index == obj.index;
+			};
+			auto operator!=(const iterator &obj) const -> bool
+			{
+				return index != obj.index;
+			};
+		};
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Default Constructor.
+		 */
+		Skyline()
+		{
+			head = npos;
+			tail = npos;
+		};
+
+		/* -----------------------------------------------------------
+			ACCESSORS
+		----------------------------------------------------------- */
+		auto begin() const -> iterator
+		{
+			return iterator(this, head);
+		};
+		auto end() const -> iterator
+		{
+			return iterator(this, npos);
+		};
+
+		auto empty() const -> bool
+		{
+			return head == npos;
+		};
+		auto size() const -> size_t
+		{
+			return heap.size();
+		};
+
+		/**
+		 * @brief Get the first scrap having the smallest z.
+		 *
+		 * @return Iterator of the scrap. end() if the skyline is empty.
+		 */
+		auto min() const -> iterator
+		{
+			return iterator(this, heap.empty() ? npos : heap.front());
+		};
+
+		/* -----------------------------------------------------------
+			ELEMENTS I/O
+		----------------------------------------------------------- */
+		/**
+		 * @brief Erase all scraps.
+		 *
+		 * @details The pool is not freed, but reused by following insertions.
+		 */
+		void clear()
+		{
+			nodes.clear();
+			garbages.clear();
+			heap.clear();
+
+			head = npos;
+			tail = npos;
+		};
+
+		void push_back(const Scrappad &scrap)
+		{
+			insert(end(), scrap);
+		};
+
+		/**
+		 * @brief Insert a scrap before a position.
+		 *
+		 * @return Iterator of the inserted scrap.
+		 */
+		auto insert(iterator position, const Scrappad &scrap) -> iterator
+		{
+			size_t next = position.index;
+			size_t prev = (next == npos) ? tail : nodes[next].prev;
+
+			// ALLOCATE A NODE FROM THE POOL
+			size_t index;
+			if (garbages.empty() == true)
+			{
+				index = nodes.size();
+				nodes.emplace_back();
+			}
+			else
+			{
+				index = garbages.back();
+				garbages.pop_back();
+			}
+
+			Node &node = nodes[index];
+			node.scrap = scrap;
+			node.prev = prev;
+			node.next = next;
+			node.order = fetch_order(prev, next);
+
+			// LINK
+			if (prev == npos)
+				head = index;
+			else
+				nodes[prev].next = index;
+
+			if (next == npos)
+				tail = index;
+			else
+				nodes[next].prev = index;
+
+			// INDEX
+			node.heap = heap.size();
+			heap.push_back(index);
+			sift_up(node.heap);
+
+			return iterator(this, index);
+		};
+
+		/**
+		 * @brief Erase a scrap.
+		 *
+		 * @return Iterator of the next scrap.
+		 */
+		auto erase(iterator position) -> iterator
+		{
+			size_t index = position.index;
+			Node &node = nodes[index];
+
+			// UNLINK
+			if (node.prev == npos)
+				head = node.next;
+			else
+				nodes[node.prev].next = node.next;
+
+			if (node.next == npos)
+				tail = node.prev;
+			else
+				nodes[node.next].prev = node.prev;
+
+			// UNINDEX
+			size_t last = heap.back();
+			heap.pop_back();
+
+			if (last != index)
+			{
+				heap[node.heap] = last;
+				nodes[last].heap = node.heap;
+
+				sift_up(node.heap);
+				sift_down(nodes[last].heap);
+			}
+
+			garbages.push_back(index);
+			return iterator(this, node.next);
+		};
+
+		/**
+		 * @brief Erase scraps in range of [first, last).
+		 *
+		 * @return Iterator of the next scrap; <i>last</i>.
+		 */
+		auto erase(iterator first, iterator last) -> iterator
+		{
+			while (first != last)
+				first = erase(first);
+
+			return last;
+		};
+
+		/* -----------------------------------------------------------
+			MODIFIERS
+		----------------------------------------------------------- */
+		void set_cumx(iterator position, double cumx)
+		{
+			nodes[position.index].scrap.cumx = cumx;
+		};
+
+		void set_cumz(iterator position, double cumz)
+		{
+			Node &node = nodes[position.index];
+			double prev_cumz = node.scrap.cumz;
+
+			node.scrap.cumz = cumz;
+			if (cumz < prev_cumz)
+				sift_up(node.heap);
+			else
+				sift_down(node.heap);
+		};
+
+	private:
+		/* -----------------------------------------------------------
+			ORDER LABELS
+		----------------------------------------------------------- */
+		auto fetch_order(size_t prev, size_t next) -> double
+		{
+			if (prev == npos && next == npos)
+				return 0;
+			else if (prev == npos)
+				return nodes[next].order - 1;
+			else if (next == npos)
+				return nodes[prev].order + 1;
+
+			double order = (nodes[prev].order + nodes[next].order) / 2;
+			if (nodes[prev].order < order && order < nodes[next].order)
+				return order;
+
+			// NO ROOM BETWEEN THE LABELS; RE-LABEL ALL.
+			// RELATIVE ORDERS ARE NOT CHANGED, THUS THE HEAP IS KEPT
+			double label = 0;
+			for (size_t i = head; i != npos; i = nodes[i].next)
+				nodes[i].order = label++;
+
+			return (nodes[prev].order + nodes[next].order) / 2;
+		};
+
+		/* -----------------------------------------------------------
+			HEAP
+		----------------------------------------------------------- */
+		auto less(size_t x, size_t y) const -> bool
+		{
+			const Node &left = nodes[heap[x]];
+			const Node &right = nodes[heap[y]];
+
+			if (left.scrap.cumz != right.scrap.cumz)
+				return left.scrap.cumz < right.scrap.cumz;
+			else
+				return left.order < right.order;
+		};
+
+		void swap(size_t x, size_t y)
+		{
+			std::swap(heap[x], heap[y]);
+
+			nodes[heap[x]].heap = x;
+			nodes[heap[y]].heap = y;
+		};
+
+		void sift_up(size_t i)
+		{
+			while (i != 0)
+			{
+				size_t parent = (i - 1) / 2;
+				if (less(i, parent) == false)
+					break;
+
+				swap(i, parent);
+				i = parent;
+			}
+		};
+
+		void sift_down(size_t i)
+		{
+			while (true)
+			{
+				size_t child = i * 2 + 1;
+				if (child >= heap.size())
+					break;
+
+				if (child + 1 < heap.size() && less(child + 1, child) == true)
+					child++;
+				if (less(child, i) == false)
+					break;
+
+				swap(i, child);
+				i = child;
+			}
+		};
+	};
+};
@@ -0,0 +1,112 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <atomic>
+#include <chrono>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief A token stopping an optimization cooperatively.
+	 *
+	 * @details
+	 * <p> A CancelToken is expired when it's canceled by #cancel(), from any thread, or when its deadline
+	 * is passed. An optimization given the token checks it at safe points and winds up quickly with the best
+	 * solution found until then: </p>
+	 *
+	 * <ul>
+	 *	<li> Packer stops evolving and returns the best of the last complete generation. </li>
+	 *	<li> Packer skips re-packing to other types of Wrapper. </li>
+	 *	<li> boxologic::Boxologic packs a Wrapper by its first trial only. </li>
+	 * </ul>
+	 *
+	 * <p> The solution is still complete; all instances are packed without overlaps, only less optimized.
+	 * </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class CancelToken
+	{
+	private:
+		std::atomic<bool> canceled;
+		std::chrono::steady_clock::time_point deadline;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Default Constructor, without deadline.
+		 */
+		CancelToken()
+			: CancelToken(std::chrono::steady_clock::time_point::max())
+		{
+		};
+
+		/**
+		 * @brief Construct from an absolute deadline.
+		 *
+		 * @param deadline Time point the token expires.
+		 */
+		CancelToken(std::chrono::steady_clock::time_point deadline)
+		{
+			this->canceled = false;
+			this->deadline = deadline;
+		};
+
+		/**
+		 * @brief Cancel the optimization.
+		 *
+		 * @details Safe to be called from any thread, during the optimization.
+		 */
+		void cancel()
+		{
+			canceled = true;
+		};
+
+		/**
+		 * @brief Set an absolute deadline.
+		 *
+		 * @details The deadline must be set before the optimization.
+		 */
+		void setDeadline(std::chrono::steady_clock::time_point val)
+		{
+			deadline = val;
+		};
+
+		/* -----------------------------------------------------------
+			GETTERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get the deadline.
+		 */
+		auto getDeadline() const -> std::chrono::steady_clock::time_point
+		{
+			return deadline;
+		};
+
+		/**
+		 * @brief Whether the token is canceled by #cancel().
+		 */
+		auto isCanceled() const -> bool
+		{
+			return canceled;
+		};
+
+		/**
+		 * @brief Whether the token is canceled or its deadline is passed.
+		 */
+		auto isExpired() const -> bool
+		{
+			if (canceled == true)
+				return true;
+			else if (deadline == std::chrono::steady_clock::time_point::max())
+				return false;
+			else
+				return std::chrono::steady_clock::now() >= deadline;
+		};
+	};
+};
+};
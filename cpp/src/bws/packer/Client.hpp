@@ -12,6 +12,12 @@
 #include <iostream>
 #include <samchon/library/Date.hpp>
 #include <samchon/library/ProgressEvent.hpp>
+#include <bws/packer/IncumbentEvent.hpp>
+#include <bws/packer/SolverPool.hpp>
+#include <bws/packer/CancelToken.hpp>
+
+#include <mutex>
+#include <unordered_set>
 
 namespace bws
 {
@@ -20,27 +26,67 @@ namespace packer
 	/**
 	 * @brief Driver for a connected client.
 	 *
+	 * @details
+	 * <p> The socket thread of a Client only decodes requests. A request of packing is pushed to the
+	 * SolverPool as a job and solved by a solver thread; the socket thread returns to listening at once. If
+	 * the pool does not admit the job, <i>rejectPack</i> is sent to the client. </p>
+	 *
+	 * <p> A job holds ownership of the Client, so that the Client outlives its jobs being solved, even
+	 * after the connection is closed. </p>
+	 *
+	 * <p> Jobs of the Client are canceled by a <i>cancel</i> request or when the connection is closed; waiting
+	 * ones are erased and the ones being solved are stopped by their {@link CancelToken cancel tokens}. </p>
+	 *
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	class Client 
-		: public protocol::IProtocol
+		: public protocol::IProtocol,
+		public std::enable_shared_from_this<Client>
 	{
 	private:
 		std::shared_ptr<protocol::ClientDriver> driver;
 
+		/**
+		 * @brief Pool solving jobs of packing, owned by the Server.
+		 *
+		 * @details Not owned by the Client; a job holds the Client, so that the pool would be destroyed on its
+		 * own solver thread if the job released the last reference.
+		 */
+		SolverPool *solverPool;
+
+		/**
+		 * @brief Tokens of jobs, waiting or being solved.
+		 */
+		std::unordered_set<std::shared_ptr<CancelToken>> tokens;
+
+		std::mutex tokens_mtx;
+
 	public:
 		/**
-		 * Construct from a socket.
+		 * Construct from a socket and a pool of solvers.
 		 *
-		 * @param socket A socket connected with the client.
+		 * @param driver A driver of socket connected with the client.
+		 * @param solverPool A pool solving jobs of packing. It must outlive the Client.
 		 */
-		Client(std::shared_ptr<protocol::ClientDriver> driver)
+		Client(std::shared_ptr<protocol::ClientDriver> driver, SolverPool *solverPool)
 		{
 			this->driver = driver;
-			driver->listen(this);
+			this->solverPool = solverPool;
 		};
 		virtual ~Client() = default;
 
+		/**
+		 * @brief Listen messages from the client, until the connection is closed.
+		 *
+		 * @details Listening ends when the client sends a closing frame or the socket is broken. Then jobs of
+		 * the client are canceled; nobody waits for their results.
+		 */
+		void listen()
+		{
+			driver->listen(this);
+			cancel();
+		};
+
 		virtual void sendData(std::shared_ptr<protocol::Invoke> invoke) override
 		{
 			driver->sendData(invoke);
@@ -53,6 +99,10 @@ namespace packer
 
 			if (invoke->getListener() == "pack")
 				pack(invoke->at(0)->getValueAsXML());
+			else if (invoke->getListener() == "cancel")
+				cancel();
+			else if (invoke->getListener() == "getStatus")
+				sendStatus();
 		};
 
 	private:
@@ -63,6 +113,18 @@ namespace packer
 		 * <p> Deducts the best optimization solution of packing and send the optimization 
 		 * result data to the client. #pack needs lots of execution time and during the optimization
 		 * process, progress data of the optimization will bed sent to the client. </p>
+		 *
+		 * <p> The <i>xml</i> is decoded here and the optimization is pushed to the SolverPool. If the pool
+		 * is full, or the client has too many requests waiting, <i>rejectPack</i> is sent with the status
+		 * of the pool, instead of the result. </p>
+		 *
+		 * <p> If the <i>xml</i> has a <i>budget</i>, the job is wound up when the budget is spent from now,
+		 * however long it has waited in the queue; the best solution found until then is sent. </p>
+		 *
+		 * <p> If the <i>xml</i> requests the anytime mode, improved solutions are sent by <i>setIncumbent</i>
+		 * during the optimization; the greedy one first. Incumbents and <i>setProgress</i> are sent by the
+		 * solver thread, in order and before the final result. The final result is sent by
+		 * <i>setWrapperArray</i>, as always. </p>
 		 * 
 		 * @param xml XML represents instances and wrappers to pack.
 		 */
@@ -74,18 +136,133 @@ namespace packer
 			auto packer = packerForm->toPacker();
 			auto gaParams = packerForm->getGAParameters();
 
-			packer->addEventListener(library::ProgressEvent::PROGRESS, handleProgress, this);
+			std::shared_ptr<Client> self = shared_from_this();
+
+			// LISTENERS ARE CALLED ON THE SOLVER THREAD, BEFORE THE RESULT IS SENT
+			std::weak_ptr<Client> weak = self;
+			packer->setProgressListener([weak](std::shared_ptr<library::ProgressEvent> event)
+			{
+				std::shared_ptr<Client> client = weak.lock();
+				if (client != nullptr)
+					client->sendProgress(event);
+			});
+			if (packerForm->isAnytime() == true)
+			{
+				packer->setIncumbentListener([weak](std::shared_ptr<IncumbentEvent> event)
+				{
+					std::shared_ptr<Client> client = weak.lock();
+					if (client != nullptr)
+						client->sendIncumbent(event);
+				});
+			}
+
+			// THE BUDGET IS COUNTED FROM THE ADMISSION, INCLUDING TIME WAITING IN THE QUEUE
+			std::shared_ptr<CancelToken> token = packerForm->toCancelToken();
+			{
+				std::unique_lock<std::mutex> uk(tokens_mtx);
+				tokens.insert(token);
+			}
+
+			bool admitted = solverPool->push(this, [self, packer, gaParams, token]()
+			{
+				std::shared_ptr<WrapperArray> wrapperArray = packer->optimize(*gaParams, token);
+				self->release(token);
+
+				self->sendData(std::make_shared<protocol::Invoke>("setWrapperArray", wrapperArray->toXML()));
+			});
 
-			std::shared_ptr<WrapperArray> wrapperArray = packer->optimize(*gaParams);
-			sendData(std::make_shared<protocol::Invoke>("setWrapperArray", wrapperArray->toXML()));
+			if (admitted == false)
+			{
+				release(token);
+				sendData(std::make_shared<protocol::Invoke>
+				(
+					"rejectPack", 
+					solverPool->getDepth(), solverPool->getCapacity(), solverPool->getOwnerCapacity()
+				));
+			}
 		};
 
-		static void handleProgress(std::shared_ptr<library::Event> evt, void *lpVoid)
+		/**
+		 * @brief Cancel jobs of the client.
+		 *
+		 * @details Waiting jobs are erased. Jobs being solved stop at their next safe points and send the
+		 * best solutions found until then, by <i>setWrapperArray</i>.
+		 */
+		void cancel()
+		{
+			solverPool->erase(this);
+
+			std::unique_lock<std::mutex> uk(tokens_mtx);
+			for (auto it = tokens.begin(); it != tokens.end(); it++)
+				(*it)->cancel();
+
+			tokens.clear();
+		};
+
+		/**
+		 * @brief Release token of a job, solved or not admitted.
+		 */
+		void release(std::shared_ptr<CancelToken> token)
 		{
-			Client *client = (Client*)lpVoid;
-			library::ProgressEvent *event = (library::ProgressEvent*)evt.get();
+			std::unique_lock<std::mutex> uk(tokens_mtx);
+			tokens.erase(token);
+		};
 
-			client->sendData(std::make_shared<protocol::Invoke>("setProgress", event->getNumerator(), event->getDenominator()));
+		/**
+		 * @brief Send status of the SolverPool.
+		 *
+		 * @details Sends <i>setStatus</i> with number of solvers, waiting jobs, peak of waiting jobs,
+		 * jobs being solved, and numbers of admitted, rejected and solved jobs.
+		 */
+		void sendStatus()
+		{
+			sendData(std::make_shared<protocol::Invoke>
+			(
+				"setStatus",
+				solverPool->size(), solverPool->getDepth(), solverPool->getPeakDepth(), solverPool->getActive(),
+				solverPool->getAccepted(), solverPool->getRejected(), solverPool->getCompleted()
+			));
+		};
+
+		/**
+		 * @brief Send progress of an optimization, on the solver thread.
+		 *
+		 * @details Sends <i>setProgress</i>. If the connection is broken, the progress is dropped and the
+		 * optimization continues; it's canceled when listening ends.
+		 */
+		void sendProgress(std::shared_ptr<library::ProgressEvent> event)
+		{
+			try
+			{
+				sendData(std::make_shared<protocol::Invoke>("setProgress", event->getNumerator(), event->getDenominator()));
+			}
+			catch (...)
+			{
+			}
+		};
+
+		/**
+		 * @brief Send an incumbent, on the solver thread.
+		 *
+		 * @details Sends <i>setIncumbent</i> with the solution, its price and utilization, their deltas and
+		 * the sequence number. If the connection is broken, the incumbent is dropped and the optimization
+		 * continues; it's canceled when listening ends.
+		 */
+		void sendIncumbent(std::shared_ptr<IncumbentEvent> event)
+		{
+			try
+			{
+				sendData(std::make_shared<protocol::Invoke>
+				(
+					"setIncumbent", event->getWrapperArray()->toXML(),
+					event->getPrice(), event->getUtilization(),
+					event->getPriceDelta(), event->getUtilizationDelta(),
+					event->getSequence()
+				));
+			}
+			catch (...)
+			{
+			}
 		};
 	};
 };
@@ -0,0 +1,1108 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <bws/packer/PackingEngine.hpp>
+#include <bws/packer/Wrap.hpp>
+
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief A packing engine by the extreme-point heuristic.
+	 *
+	 * @details
+	 * <p> Instances are placed one by one, in descending order of volume. An instance is placed on the
+	 * lowest <i>extreme point</i>, a corner where it can be placed without overlapping others, in the
+	 * orientation making the lowest top. Placing an instance generates new extreme points; its three
+	 * far corners, each projected toward the origin along the other two axes until it touches the
+	 * Wrapper or another instance. </p>
+	 *
+	 * <p> Placed instances are registered to cells of a uniform grid over the Wrapper, so that a test of
+	 * overlap and a projection access only the instances near by. </p>
+	 *
+	 * <p> Each point keeps its free extents; distances to the first obstacles along +X, +Y and +Z. They
+	 * only shrink while packing, so that a kept extent is an upper bound even if it's stale, and is measured
+	 * again only when a test of overlap fails on the point. A point is discarded if none of the instances
+	 * not placed yet can fit its extents. </p>
+	 *
+	 * <p> Extreme points are kept in a treap by (y, z, x), indexed by their extents (PointTree). An
+	 * instance visits, from the lowest, only the points of which extents can contain it; subtrees of
+	 * points too small are skipped as a whole. The visit stops at the first point too high. </p>
+	 *
+	 * <p> A visit costs O(log n) for each candidate point. Candidates of which extents are stale may fail the
+	 * test of overlap, so that the worst case is still quadratic in number of the instances; in practice,
+	 * the candidates are few and the packing is much faster than Boxologic, which searches layers
+	 * exhaustively. It's less dense than Boxologic. </p>
+	 *
+	 * @reference Crainic, Perboli, Tadei. Extreme Point-Based Heuristics for Three-Dimensional Bin Packing,
+	 *			  INFORMS Journal on Computing 20(3), 2008.
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class ExtremePoint
+		: public PackingEngine
+	{
+	private:
+		/**
+		 * @brief Tolerance of comparing coordinates.
+		 */
+		static constexpr double EPSILON = 1e-9;
+
+		/**
+		 * @brief Maximum number of cells in the grid.
+		 */
+		static const size_t MAX_CELLS = 1 << 15;
+
+		/**
+		 * @brief An instance to be placed.
+		 */
+		struct Box
+		{
+			double width;
+			double height;
+			double length;
+			double volume;
+
+			double x;
+			double y;
+			double z;
+
+			double layout_width;
+			double layout_height;
+			double layout_length;
+
+			bool packed;
+		};
+
+		/**
+		 * @brief An extreme point.
+		 */
+		struct Point
+		{
+			double x;
+			double y;
+			double z;
+
+			/**
+			 * @brief Upper bounds of free extents along +X, +Y and +Z. Infinity if not measured.
+			 *
+			 * @details Not a part of the order.
+			 */
+			double extents[3];
+
+			Point(double x, double y, double z)
+			{
+				this->x = x;
+				this->y = y;
+				this->z = z;
+
+				extents[0] = extents[1] = extents[2] = std::numeric_limits<double>::infinity();
+			};
+
+			auto operator<(const Point &obj) const -> bool
+			{
+				if (y != obj.y)
+					return y < obj.y;
+				else if (z != obj.z)
+					return z < obj.z;
+				else
+					return x < obj.x;
+			};
+		};
+
+		/**
+		 * @brief Extreme points in order of (y, z, x), indexed by their capacities.
+		 *
+		 * @details
+		 * <p> A treap of which nodes are pooled in a vector, like boxologic::Skyline. Capacity of a point is
+		 * its free extents limited by the Wrapper, in ascending order. A box can be placed on a point only if
+		 * its sorted dimensions are not greater than the capacities. </p>
+		 *
+		 * <p> Each node keeps maximums of the capacities in its subtree, so that #find() skips subtrees of
+		 * which no point can contain a box, and reaches the first candidate in O(log n) when most points
+		 * are too small for the box. </p>
+		 */
+		class PointTree
+		{
+		private:
+			static const size_t npos = (size_t)-1;
+
+			struct Node
+			{
+				Point point;
+
+				/**
+				 * @brief Capacities of the point, in ascending order.
+				 */
+				std::array<double, 3> capacities;
+
+				/**
+				 * @brief Maximums of #capacities in the subtree.
+				 */
+				std::array<double, 3> maximums;
+
+				uint32_t priority;
+				size_t left;
+				size_t right;
+			};
+
+			/**
+			 * @brief Pool of nodes.
+			 */
+			std::vector<Node> nodes;
+
+			/**
+			 * @brief Indices of erased nodes in the pool, to be recycled.
+			 */
+			std::vector<size_t> garbages;
+
+			size_t root;
+			size_t count;
+
+			/**
+			 * @brief State of xorshift generating priorities; deterministic.
+			 */
+			uint32_t seed;
+
+		public:
+			PointTree()
+			{
+				clear();
+			};
+
+			/**
+			 * @brief Erase all points.
+			 *
+			 * @details The pool is not freed, but reused by following insertions.
+			 */
+			void clear()
+			{
+				nodes.clear();
+				garbages.clear();
+
+				root = npos;
+				count = 0;
+				seed = 2463534242u;
+			};
+
+			auto size() const -> size_t
+			{
+				return count;
+			};
+
+			auto contains(const Point &point) const -> bool
+			{
+				size_t node = root;
+				while (node != npos)
+				{
+					const Node &n = nodes[node];
+					if (point < n.point)
+						node = n.left;
+					else if (n.point < point)
+						node = n.right;
+					else
+						return true;
+				}
+				return false;
+			};
+
+			/**
+			 * @brief Insert a point, if it doesn't exist.
+			 *
+			 * @param point The point.
+			 * @param capacities Capacities of the point, in ascending order.
+			 */
+			void insert(const Point &point, const std::array<double, 3> &capacities)
+			{
+				if (contains(point) == true)
+					return;
+
+				// ALLOCATE A NODE FROM THE POOL
+				size_t index;
+				if (garbages.empty() == true)
+				{
+					index = nodes.size();
+					nodes.push_back({ point, capacities, capacities, 0, npos, npos });
+				}
+				else
+				{
+					index = garbages.back();
+					garbages.pop_back();
+
+					nodes[index] = { point, capacities, capacities, 0, npos, npos };
+				}
+
+				seed ^= seed << 13;
+				seed ^= seed >> 17;
+				seed ^= seed << 5;
+				nodes[index].priority = seed;
+
+				size_t left, right;
+				split(root, point, left, right);
+
+				root = merge(merge(left, index), right);
+				count++;
+			};
+
+			void erase(const Point &point)
+			{
+				root = erase(root, point);
+			};
+
+			/**
+			 * @brief Update extents and capacities of a point.
+			 */
+			void update(const Point &point, const std::array<double, 3> &capacities)
+			{
+				update(root, point, capacities);
+			};
+
+			/**
+			 * @brief Find the first point after another, which may contain a box.
+			 *
+			 * @param after A point; the found one must be after it. nullptr to find from the first.
+			 * @param dims Sorted dimensions of the box.
+			 * @param tolerance Tolerance of comparing the dimensions and capacities.
+			 *
+			 * @return The found point; valid until the next modification. nullptr if not found.
+			 */
+			auto find(const Point *after, const std::array<double, 3> &dims, double tolerance) const -> const Point*
+			{
+				size_t index = find(root, after, dims, tolerance);
+
+				return (index == npos) ? nullptr : &nodes[index].point;
+			};
+
+		private:
+			auto find(size_t node, const Point *after, const std::array<double, 3> &dims, double tolerance) const -> size_t
+			{
+				if (node == npos || contains(nodes[node].maximums, dims, tolerance) == false)
+					return npos;
+
+				const Node &n = nodes[node];
+				if (after == nullptr || *after < n.point)
+				{
+					size_t ret = find(n.left, after, dims, tolerance);
+					if (ret != npos)
+						return ret;
+					else if (contains(n.capacities, dims, tolerance) == true)
+						return node;
+				}
+				return find(n.right, after, dims, tolerance);
+			};
+
+			static auto contains(const std::array<double, 3> &capacities, const std::array<double, 3> &dims, double tolerance) -> bool
+			{
+				return dims[0] <= capacities[0] + tolerance
+					&& dims[1] <= capacities[1] + tolerance
+					&& dims[2] <= capacities[2] + tolerance;
+			};
+
+			/**
+			 * @brief Split a subtree into points less than a key and the others.
+			 */
+			void split(size_t node, const Point &key, size_t &left, size_t &right)
+			{
+				if (node == npos)
+				{
+					left = right = npos;
+					return;
+				}
+
+				if (nodes[node].point < key)
+				{
+					size_t child;
+					split(nodes[node].right, key, child, right);
+
+					nodes[node].right = child;
+					left = node;
+				}
+				else
+				{
+					size_t child;
+					split(nodes[node].left, key, left, child);
+
+					nodes[node].left = child;
+					right = node;
+				}
+				pull(node);
+			};
+
+			/**
+			 * @brief Merge two subtrees, of which all points of the <i>left</i> are less.
+			 */
+			auto merge(size_t left, size_t right) -> size_t
+			{
+				if (left == npos)
+					return right;
+				else if (right == npos)
+					return left;
+
+				if (nodes[left].priority > nodes[right].priority)
+				{
+					size_t child = merge(nodes[left].right, right);
+					nodes[left].right = child;
+
+					pull(left);
+					return left;
+				}
+				else
+				{
+					size_t child = merge(left, nodes[right].left);
+					nodes[right].left = child;
+
+					pull(right);
+					return right;
+				}
+			};
+
+			auto erase(size_t node, const Point &key) -> size_t
+			{
+				if (node == npos)
+					return npos;
+
+				if (key < nodes[node].point)
+				{
+					size_t child = erase(nodes[node].left, key);
+					nodes[node].left = child;
+				}
+				else if (nodes[node].point < key)
+				{
+					size_t child = erase(nodes[node].right, key);
+					nodes[node].right = child;
+				}
+				else
+				{
+					size_t ret = merge(nodes[node].left, nodes[node].right);
+
+					garbages.push_back(node);
+					count--;
+
+					return ret;
+				}
+				pull(node);
+				return node;
+			};
+
+			void update(size_t node, const Point &key, const std::array<double, 3> &capacities)
+			{
+				if (node == npos)
+					return;
+
+				Node &n = nodes[node];
+				if (key < n.point)
+					update(n.left, key, capacities);
+				else if (n.point < key)
+					update(n.right, key, capacities);
+				else
+				{
+					n.point = key;
+					n.capacities = capacities;
+				}
+				pull(node);
+			};
+
+			/**
+			 * @brief Recompute maximums of a node, from its children.
+			 */
+			void pull(size_t node)
+			{
+				Node &n = nodes[node];
+				n.maximums = n.capacities;
+
+				size_t children[2] = { n.left, n.right };
+				for (size_t c = 0; c < 2; c++)
+					if (children[c] != npos)
+						for (size_t k = 0; k < 3; k++)
+							n.maximums[k] = std::max(n.maximums[k], nodes[children[c]].maximums[k]);
+			};
+		};
+
+		/* -----------------------------------------------------------
+			PARAMETRIC DATA
+		----------------------------------------------------------- */
+		std::shared_ptr<Wrapper> wrapper;
+
+		/**
+		 * @brief Containable dimensions of the #wrapper.
+		 */
+		double width, height, length;
+
+		/* -----------------------------------------------------------
+			BUFFERS, REUSED BY FOLLOWING PACKINGS
+		----------------------------------------------------------- */
+		std::vector<Box> boxes;
+
+		/**
+		 * @brief Indices of the #boxes, in order of placement trials.
+		 */
+		std::vector<size_t> order;
+
+		/**
+		 * @brief Indices of placed #boxes, in order of placement.
+		 */
+		std::vector<size_t> placed;
+
+		/**
+		 * @brief Extreme points, in order of (y, z, x).
+		 */
+		PointTree points;
+
+		/**
+		 * @brief Indices of #placed boxes overlapping each cell.
+		 */
+		std::vector<std::vector<uint32_t>> cells;
+
+		/**
+		 * @brief Number of cells on each axis.
+		 */
+		size_t nx, ny, nz;
+
+		/**
+		 * @brief Edge length of a cell.
+		 */
+		double cellSize;
+
+		/**
+		 * @brief Marks of #placed boxes visited by the current query.
+		 */
+		std::vector<uint32_t> stamps;
+		uint32_t stamp;
+
+		/**
+		 * @brief Sorted dimensions of boxes failed to be placed; only minimal ones.
+		 *
+		 * @details Space only decreases while packing. A box not smaller than a failed box fails, too.
+		 */
+		std::vector<std::array<double, 3>> failures;
+
+		/**
+		 * @brief Minimums of sorted dimensions of the boxes, from each position of the #order to the end.
+		 */
+		std::vector<std::array<double, 3>> remainders;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Default Constructor.
+		 *
+		 * @details Constructs a reusable engine. Buffers are reset and reused by following packings.
+		 */
+		ExtremePoint()
+		{
+			stamp = 0;
+		};
+		virtual ~ExtremePoint() = default;
+
+		/* -----------------------------------------------------------
+			OPERATORS
+		----------------------------------------------------------- */
+		virtual auto pack(std::shared_ptr<Wrapper> wrapper, std::shared_ptr<InstanceArray> instanceArray)
+			-> std::pair<std::shared_ptr<Wrapper>, std::shared_ptr<InstanceArray>> override
+		{
+			boxes.resize(instanceArray->size());
+			for (size_t i = 0; i < instanceArray->size(); i++)
+			{
+				const std::shared_ptr<Instance> &instance = instanceArray->at(i);
+
+				boxes[i].width = instance->getWidth();
+				boxes[i].height = instance->getHeight();
+				boxes[i].length = instance->getLength();
+				boxes[i].volume = instance->getVolume();
+			}
+			place(wrapper);
+
+			// DECODE
+			std::shared_ptr<InstanceArray> leftInstances(new InstanceArray());
+
+			for (size_t i = 0; i < boxes.size(); i++)
+				if (boxes[i].packed == false)
+					leftInstances->push_back(instanceArray->at(i));
+
+			for (size_t i = 0; i < placed.size(); i++)
+				emplace(instanceArray->at(placed[i]), boxes[placed[i]]);
+
+			this->wrapper = nullptr;
+			return { wrapper, leftInstances };
+		};
+
+		virtual auto pack(std::shared_ptr<Wrapper> wrapper, std::shared_ptr<InstanceTable> instanceTable, std::vector<uint32_t> &skus)
+			-> std::shared_ptr<Wrapper> override
+		{
+			boxes.resize(skus.size());
+			for (size_t i = 0; i < skus.size(); i++)
+			{
+				const InstanceTable::Record &record = instanceTable->at(skus[i]);
+
+				boxes[i].width = record.width;
+				boxes[i].height = record.height;
+				boxes[i].length = record.length;
+				boxes[i].volume = record.volume;
+			}
+			place(wrapper);
+
+			// DECODE
+			for (size_t i = 0; i < placed.size(); i++)
+				emplace(instanceTable->getInstance(skus[placed[i]]), boxes[placed[i]]);
+
+			size_t lefts = 0;
+			for (size_t i = 0; i < boxes.size(); i++)
+				if (boxes[i].packed == false)
+					skus[lefts++] = skus[i];
+			skus.resize(lefts);
+
+			this->wrapper = nullptr;
+			return wrapper;
+		};
+
+	private:
+		/* -----------------------------------------------------------
+			PLACEMENT
+		----------------------------------------------------------- */
+		/**
+		 * @brief Place the #boxes into a Wrapper.
+		 */
+		void place(std::shared_ptr<Wrapper> wrapper)
+		{
+			this->wrapper = wrapper;
+			wrapper->clear();
+
+			width = wrapper->getContainableWidth();
+			height = wrapper->getContainableHeight();
+			length = wrapper->getContainableLength();
+
+			// RESET BUFFERS
+			placed.clear();
+			points.clear();
+			failures.clear();
+			stamps.clear();
+
+			order.resize(boxes.size());
+			for (size_t i = 0; i < boxes.size(); i++)
+			{
+				boxes[i].packed = false;
+				order[i] = i;
+			}
+			std::stable_sort(order.begin(), order.end(), [this](size_t x, size_t y) -> bool
+				{
+					return boxes[x].volume > boxes[y].volume;
+				});
+
+			// SMALLEST DIMENSIONS OF THE BOXES NOT PLACED YET, FROM EACH POSITION
+			const double infinity = std::numeric_limits<double>::infinity();
+
+			remainders.resize(order.size() + 1);
+			remainders[order.size()] = { infinity, infinity, infinity };
+
+			for (size_t i = order.size(); i-- > 0;)
+			{
+				std::array<double, 3> dims = sortedDims(boxes[order[i]]);
+				for (size_t k = 0; k < 3; k++)
+					remainders[i][k] = std::min(dims[k], remainders[i + 1][k]);
+			}
+
+			constructGrid();
+			insert(Point(0.0, 0.0, 0.0), remainders[0]);
+
+			// FIRST FIT ON THE EXTREME POINTS
+			for (size_t i = 0; i < order.size(); i++)
+			{
+				std::array<double, 3> dims = sortedDims(boxes[order[i]]);
+
+				if (dominates(dims) == true)
+					continue;
+
+				if (place(order[i], remainders[i + 1]) == false)
+				{
+					// FAILED BOXES NOT SMALLER THAN THIS ARE REDUNDANT
+					failures.erase(std::remove_if(failures.begin(), failures.end(), [&dims](const std::array<double, 3> &failure) -> bool
+						{
+							return failure[0] >= dims[0] && failure[1] >= dims[1] && failure[2] >= dims[2];
+						}), failures.end());
+					failures.push_back(dims);
+				}
+			}
+		};
+
+		/**
+		 * @brief Place a box on the lowest extreme point.
+		 *
+		 * @param index Index of the box.
+		 * @param remainder Minimums of sorted dimensions of the boxes after this one.
+		 * @return Whether the box is placed.
+		 */
+		auto place(size_t index, const std::array<double, 3> &remainder) -> bool
+		{
+			Box &box = boxes[index];
+			double orientations[6][3] =
+			{
+				{ box.width, box.height, box.length }, { box.length, box.height, box.width },
+				{ box.length, box.width, box.height }, { box.height, box.width, box.length },
+				{ box.width, box.length, box.height }, { box.height, box.length, box.width }
+			};
+
+			std::array<double, 3> sorted = sortedDims(box);
+
+			// CANDIDATES, POINTS OF WHICH CAPACITIES MAY CONTAIN THE BOX
+			Point point(0.0, 0.0, 0.0);
+			const Point *after = nullptr;
+
+			while (true)
+			{
+				const Point *candidate = points.find(after, sorted, 2 * EPSILON);
+				if (candidate == nullptr)
+					break;
+
+				point = *candidate;
+				after = &point;
+
+				// POINTS ARE IN ORDER OF Y; NO ORIENTATION FITS ON THIS POINT AND FOLLOWINGS
+				if (point.y + sorted[0] > height + EPSILON)
+					break;
+
+				// A POINT COVERED BY A PLACED BOX IS NOT AN EXTREME POINT ANYMORE
+				if (overlaps(point.x, point.y, point.z, 0.0, 0.0, 0.0) == true)
+				{
+					points.erase(point);
+					continue;
+				}
+
+				// THE ORIENTATION MAKING THE LOWEST TOP
+				int best = -1;
+				bool blocked = false;
+
+				for (int o = 0; o < 6; o++)
+				{
+					const double *dims = orientations[o];
+
+					if (point.x + dims[0] > width + EPSILON
+						|| point.y + dims[1] > height + EPSILON
+						|| point.z + dims[2] > length + EPSILON)
+						continue;
+					if (best != -1 && (dims[1] > orientations[best][1]
+						|| (dims[1] == orientations[best][1] && dims[2] >= orientations[best][2])))
+						continue;
+					if (dims[0] > point.extents[0] + EPSILON
+						|| dims[1] > point.extents[1] + EPSILON
+						|| dims[2] > point.extents[2] + EPSILON)
+						continue;
+					if (overlaps(point.x, point.y, point.z, dims[0], dims[1], dims[2]) == true)
+					{
+						blocked = true;
+						continue;
+					}
+
+					best = o;
+				}
+
+				if (best == -1)
+				{
+					// THE EXTENTS ARE STALE; MEASURE THEM AGAIN
+					if (blocked == true)
+					{
+						for (int axis = 0; axis < 3; axis++)
+							point.extents[axis] = reach(point.x, point.y, point.z, axis, point.extents[axis]);
+
+						points.update(point, capacities(point));
+					}
+
+					if (isDead(point, remainder) == true)
+						points.erase(point);
+					continue;
+				}
+
+				box.x = point.x;
+				box.y = point.y;
+				box.z = point.z;
+				box.layout_width = orientations[best][0];
+				box.layout_height = orientations[best][1];
+				box.layout_length = orientations[best][2];
+				box.packed = true;
+
+				points.erase(point);
+				insert(index, remainder);
+
+				return true;
+			}
+			return false;
+		};
+
+		/**
+		 * @brief Register a placed box, and insert extreme points generated by the box.
+		 *
+		 * @param index Index of the box.
+		 * @param remainder Minimums of sorted dimensions of the boxes after this one.
+		 */
+		void insert(size_t index, const std::array<double, 3> &remainder)
+		{
+			const Box &box = boxes[index];
+
+			placed.push_back(index);
+			stamps.push_back(0);
+
+			size_t x1, y1, z1, x2, y2, z2;
+			range(box.x, box.y, box.z, box.layout_width, box.layout_height, box.layout_length, x1, y1, z1, x2, y2, z2);
+
+			for (size_t z = z1; z <= z2; z++)
+				for (size_t y = y1; y <= y2; y++)
+					for (size_t x = x1; x <= x2; x++)
+						cells[(z * ny + y) * nx + x].push_back((uint32_t)placed.size() - 1);
+
+			// THE FAR CORNERS, PROJECTED ALONG THE OTHER AXES
+			double right = box.x + box.layout_width;
+			double top = box.y + box.layout_height;
+			double front = box.z + box.layout_length;
+
+			if (right < width - EPSILON)
+			{
+				insert(Point(right, projectY(right, box.y, box.z), box.z), remainder);
+				insert(Point(right, box.y, projectZ(right, box.y, box.z)), remainder);
+			}
+			if (top < height - EPSILON)
+			{
+				insert(Point(projectX(box.x, top, box.z), top, box.z), remainder);
+				insert(Point(box.x, top, projectZ(box.x, top, box.z)), remainder);
+			}
+			if (front < length - EPSILON)
+			{
+				insert(Point(projectX(box.x, box.y, front), box.y, front), remainder);
+				insert(Point(box.x, projectY(box.x, box.y, front), front), remainder);
+			}
+		};
+
+		/**
+		 * @brief Insert an extreme point, measuring its free extents.
+		 *
+		 * @details A point covered by a placed box, or on which none of the boxes not placed yet can be
+		 *			placed, is not inserted; it would never be used.
+		 *
+		 * @param point The point.
+		 * @param remainder Minimums of sorted dimensions of the boxes not placed yet.
+		 */
+		void insert(Point point, const std::array<double, 3> &remainder)
+		{
+			if (points.contains(point) == true || overlaps(point.x, point.y, point.z, 0.0, 0.0, 0.0) == true)
+				return;
+
+			for (int axis = 0; axis < 3; axis++)
+				point.extents[axis] = reach(point.x, point.y, point.z, axis, point.extents[axis]);
+
+			if (isDead(point, remainder) == false)
+				points.insert(point, capacities(point));
+		};
+
+		/**
+		 * @brief Test whether a space overlaps placed boxes.
+		 *
+		 * @details A space of zero dimensions is a point; it overlaps a box containing it, except on the
+		 *			far faces of the box.
+		 */
+		auto overlaps(double x, double y, double z, double w, double h, double l) -> bool
+		{
+			size_t x1, y1, z1, x2, y2, z2;
+			range(x, y, z, w, h, l, x1, y1, z1, x2, y2, z2);
+
+			nextStamp();
+
+			for (size_t cz = z1; cz <= z2; cz++)
+				for (size_t cy = y1; cy <= y2; cy++)
+					for (size_t cx = x1; cx <= x2; cx++)
+					{
+						const std::vector<uint32_t> &cell = cells[(cz * ny + cy) * nx + cx];
+
+						for (size_t i = 0; i < cell.size(); i++)
+						{
+							if (stamps[cell[i]] == stamp)
+								continue;
+							stamps[cell[i]] = stamp;
+
+							const Box &box = boxes[placed[cell[i]]];
+							if (intersects(x, w, box.x, box.layout_width)
+								&& intersects(y, h, box.y, box.layout_height)
+								&& intersects(z, l, box.z, box.layout_length))
+								return true;
+						}
+					}
+			return false;
+		};
+
+		/**
+		 * @brief Project a point to -Y, until it touches the floor or a placed box.
+		 *
+		 * @return Projected y.
+		 */
+		auto projectY(double x, double y, double z) -> double
+		{
+			return project(x, y, z, 1);
+		};
+
+		/**
+		 * @brief Project a point to -Z, until it touches the back or a placed box.
+		 *
+		 * @return Projected z.
+		 */
+		auto projectZ(double x, double y, double z) -> double
+		{
+			return project(x, y, z, 2);
+		};
+
+		/**
+		 * @brief Project a point to -X, until it touches the side or a placed box.
+		 *
+		 * @return Projected x.
+		 */
+		auto projectX(double x, double y, double z) -> double
+		{
+			return project(x, y, z, 0);
+		};
+
+		/**
+		 * @brief Measure free extent of a point along an axis, away from the origin.
+		 *
+		 * @details Scans cells of the line from the point to the far side, and returns distance to the
+		 *			nearest near face of boxes on the line. A box of a larger extent on the axis overlaps one
+		 *			of them, if it's placed on the point.
+		 *
+		 *			Cells are scanned in order of the axis, until the nearest face found. A box beginning
+		 *			before a cell is registered to the former cells, too.
+		 *
+		 * @param bound An upper bound of the extent; the scan stops there.
+		 */
+		auto reach(double x, double y, double z, int axis, double bound) -> double
+		{
+			double position[3] = { x, y, z };
+			double limits[3] = { width, height, length };
+			double ret = std::min(limits[axis], position[axis] + bound);
+
+			size_t indices[3] = { cellOf(x, nx), cellOf(y, ny), cellOf(z, nz) };
+			size_t counts[3] = { nx, ny, nz };
+
+			nextStamp();
+
+			for (size_t c = indices[axis]; c < counts[axis] && c * cellSize <= ret + EPSILON; c++)
+			{
+				indices[axis] = c;
+				const std::vector<uint32_t> &cell = cells[(indices[2] * ny + indices[1]) * nx + indices[0]];
+
+				for (size_t i = 0; i < cell.size(); i++)
+				{
+					if (stamps[cell[i]] == stamp)
+						continue;
+					stamps[cell[i]] = stamp;
+
+					const Box &box = boxes[placed[cell[i]]];
+					double begins[3] = { box.x, box.y, box.z };
+					double ends[3] = { box.x + box.layout_width, box.y + box.layout_height, box.z + box.layout_length };
+
+					bool onLine = true;
+					for (int k = 0; k < 3 && onLine == true; k++)
+						if (k != axis)
+							onLine = begins[k] <= position[k] + EPSILON && position[k] < ends[k] - EPSILON;
+
+					if (onLine == true && ends[axis] > position[axis] + EPSILON)
+						ret = std::min(ret, std::max(begins[axis], position[axis]));
+				}
+			}
+			return ret - position[axis];
+		};
+
+		/**
+		 * @brief Project a point along an axis toward the origin.
+		 *
+		 * @details Scans cells of the line from the point toward the origin, and returns the largest far face
+		 *			of boxes on the line, not beyond the point.
+		 */
+		auto project(double x, double y, double z, int axis) -> double
+		{
+			double position[3] = { x, y, z };
+			double ret = 0.0;
+
+			size_t x2 = cellOf(x, nx), y2 = cellOf(y, ny), z2 = cellOf(z, nz);
+			size_t x1 = (axis == 0) ? 0 : x2;
+			size_t y1 = (axis == 1) ? 0 : y2;
+			size_t z1 = (axis == 2) ? 0 : z2;
+
+			nextStamp();
+
+			for (size_t cz = z1; cz <= z2; cz++)
+				for (size_t cy = y1; cy <= y2; cy++)
+					for (size_t cx = x1; cx <= x2; cx++)
+					{
+						const std::vector<uint32_t> &cell = cells[(cz * ny + cy) * nx + cx];
+
+						for (size_t i = 0; i < cell.size(); i++)
+						{
+							if (stamps[cell[i]] == stamp)
+								continue;
+							stamps[cell[i]] = stamp;
+
+							const Box &box = boxes[placed[cell[i]]];
+							double begins[3] = { box.x, box.y, box.z };
+							double ends[3] = { box.x + box.layout_width, box.y + box.layout_height, box.z + box.layout_length };
+
+							bool onLine = true;
+							for (int k = 0; k < 3 && onLine == true; k++)
+								if (k != axis)
+									onLine = begins[k] <= position[k] + EPSILON && position[k] < ends[k] - EPSILON;
+
+							if (onLine == true && ends[axis] <= position[axis] + EPSILON && ends[axis] > ret)
+								ret = ends[axis];
+						}
+					}
+			return ret;
+		};
+
+		/* -----------------------------------------------------------
+			GRID
+		----------------------------------------------------------- */
+		/**
+		 * @brief Construct the grid, of which cell is about a box on average.
+		 */
+		void constructGrid()
+		{
+			double volume = 0.0;
+			for (size_t i = 0; i < boxes.size(); i++)
+				volume += boxes[i].volume;
+
+			cellSize = boxes.empty() ? std::max(width, std::max(height, length)) : std::cbrt(volume / boxes.size());
+			cellSize = std::max(cellSize, std::cbrt(width * height * length / MAX_CELLS));
+
+			if (cellSize <= 0.0)
+				cellSize = 1.0;
+
+			nx = std::max<size_t>(1, (size_t)std::ceil(width / cellSize));
+			ny = std::max<size_t>(1, (size_t)std::ceil(height / cellSize));
+			nz = std::max<size_t>(1, (size_t)std::ceil(length / cellSize));
+
+			cells.resize(nx * ny * nz);
+			for (size_t i = 0; i < cells.size(); i++)
+				cells[i].clear();
+		};
+
+		/**
+		 * @brief Get range of cells overlapping a space.
+		 */
+		void range(double x, double y, double z, double w, double h, double l,
+			size_t &x1, size_t &y1, size_t &z1, size_t &x2, size_t &y2, size_t &z2) const
+		{
+			x1 = cellOf(x, nx);
+			y1 = cellOf(y, ny);
+			z1 = cellOf(z, nz);
+
+			x2 = std::max(x1, cellOf(x + w - EPSILON, nx));
+			y2 = std::max(y1, cellOf(y + h - EPSILON, ny));
+			z2 = std::max(z1, cellOf(z + l - EPSILON, nz));
+		};
+
+		auto cellOf(double position, size_t n) const -> size_t
+		{
+			if (position <= 0.0)
+				return 0;
+
+			size_t index = (size_t)(position / cellSize);
+			return std::min(index, n - 1);
+		};
+
+		void nextStamp()
+		{
+			if (++stamp == 0)
+			{
+				std::fill(stamps.begin(), stamps.end(), 0);
+				stamp = 1;
+			}
+		};
+
+		/* -----------------------------------------------------------
+			HELPERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Test whether two intervals intersect.
+		 *
+		 * @details An interval of zero length is a point, intersecting an interval containing it, except on
+		 *			the end.
+		 */
+		static auto intersects(double begin, double size, double otherBegin, double otherSize) -> bool
+		{
+			if (size == 0.0)
+				return otherBegin <= begin + EPSILON && begin < otherBegin + otherSize - EPSILON;
+			else
+				return begin < otherBegin + otherSize - EPSILON && otherBegin < begin + size - EPSILON;
+		};
+
+		/**
+		 * @brief Test whether none of boxes can be placed on a point, by its free extents.
+		 *
+		 * @param point The point.
+		 * @param remainder Minimums of sorted dimensions of the boxes.
+		 */
+		auto isDead(const Point &point, const std::array<double, 3> &remainder) const -> bool
+		{
+			std::array<double, 3> extents = capacities(point);
+
+			for (size_t k = 0; k < 3; k++)
+				if (remainder[k] > extents[k] + EPSILON)
+					return true;
+
+			return false;
+		};
+
+		/**
+		 * @brief Get capacities of a point; its free extents limited by the Wrapper, in ascending order.
+		 */
+		auto capacities(const Point &point) const -> std::array<double, 3>
+		{
+			std::array<double, 3> ret =
+			{
+				std::min(point.extents[0], width - point.x),
+				std::min(point.extents[1], height - point.y),
+				std::min(point.extents[2], length - point.z)
+			};
+			std::sort(ret.begin(), ret.end());
+
+			return ret;
+		};
+
+		static auto sortedDims(const Box &box) -> std::array<double, 3>
+		{
+			std::array<double, 3> dims = { box.width, box.height, box.length };
+			std::sort(dims.begin(), dims.end());
+
+			return dims;
+		};
+
+		/**
+		 * @brief Test whether a box is not smaller than a failed one.
+		 */
+		auto dominates(const std::array<double, 3> &dims) const -> bool
+		{
+			for (size_t i = 0; i < failures.size(); i++)
+				if (dims[0] >= failures[i][0] && dims[1] >= failures[i][1] && dims[2] >= failures[i][2])
+					return true;
+
+			return false;
+		};
+
+		/**
+		 * @brief Construct a Wrap of a placed box.
+		 */
+		void emplace(const std::shared_ptr<Instance> &instance, const Box &box)
+		{
+			double thickness = wrapper->getThickness();
+
+			Wrap *wrap = new Wrap(wrapper.get(), instance, box.x + thickness, box.y + thickness, box.z + thickness);
+			wrap->estimateOrientation(box.layout_width, box.layout_height, box.layout_length);
+
+			wrapper->emplace_back(wrap);
+		};
+	};
+};
+};
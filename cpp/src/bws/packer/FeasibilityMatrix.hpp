@@ -0,0 +1,202 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <bws/packer/WrapperArray.hpp>
+#include <bws/packer/InstanceTable.hpp>
+
+#include <array>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+#include <cstdint>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief A matrix of feasibility, whether each type of Wrapper can contain each Instance.
+	 *
+	 * @details
+	 * <p> Wrapper::operator>=() sorts dimensions of the Wrapper and the Instance on every call. FeasibilityMatrix
+	 * sorts containable dimensions of each Wrapper once, and stores a bitset of the feasible Wrappers for each
+	 * distinct Instance, so that the test is done by a bit test. </p>
+	 *
+	 * <p> Wrappers are identified by their indices in the WrapperArray and distinct instances by their SKU
+	 * ids in an InstanceTable. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class FeasibilityMatrix
+	{
+	private:
+		/**
+		 * @brief Types of Wrapper.
+		 */
+		std::shared_ptr<WrapperArray> wrapperArray;
+
+		/**
+		 * @brief Indices of the Wrappers, by their addresses.
+		 */
+		std::unordered_map<const Wrapper*, size_t> wrapperIndices;
+
+		/**
+		 * @brief Indices of the Wrappers, by their keys.
+		 */
+		std::unordered_map<std::string, size_t> keyIndices;
+
+		/**
+		 * @brief Distinct instances.
+		 */
+		std::shared_ptr<InstanceTable> instanceTable;
+
+		/**
+		 * @brief Bitsets of feasible Wrappers, for each distinct instance.
+		 */
+		std::vector<std::vector<uint64_t>> bitsets;
+
+		/**
+		 * @brief Indices of feasible Wrappers, for each distinct instance.
+		 */
+		std::vector<std::vector<size_t>> feasibles;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Construct from members.
+		 *
+		 * @param wrapperArray Types of Wrapper.
+		 * @param instanceTable Distinct instances to be wrapped.
+		 */
+		FeasibilityMatrix(std::shared_ptr<WrapperArray> wrapperArray, std::shared_ptr<InstanceTable> instanceTable)
+		{
+			this->wrapperArray = wrapperArray;
+			this->instanceTable = instanceTable;
+
+			// SORTED CONTAINABLE DIMENSIONS OF WRAPPERS
+			std::vector<std::array<double, 3>> wrapperDims;
+			wrapperDims.reserve(wrapperArray->size());
+
+			for (size_t i = 0; i < wrapperArray->size(); i++)
+			{
+				const std::shared_ptr<Wrapper> &wrapper = wrapperArray->at(i);
+				std::array<double, 3> dims = { wrapper->getContainableWidth(), wrapper->getContainableHeight(), wrapper->getContainableLength() };
+				std::sort(dims.begin(), dims.end());
+
+				wrapperDims.push_back(dims);
+				wrapperIndices.insert({ wrapper.get(), i });
+				keyIndices.insert({ wrapper->key(), i });
+			}
+
+			// BITSETS OF DISTINCT INSTANCES
+			bitsets.reserve(instanceTable->size());
+			feasibles.reserve(instanceTable->size());
+
+			for (size_t i = 0; i < instanceTable->size(); i++)
+			{
+				const InstanceTable::Record &record = instanceTable->at(i);
+
+				std::array<double, 3> dims = { record.width, record.height, record.length };
+				std::sort(dims.begin(), dims.end());
+
+				std::vector<uint64_t> bitset(wrapperDims.size() / 64 + 1, 0);
+				std::vector<size_t> indices;
+
+				for (size_t j = 0; j < wrapperDims.size(); j++)
+					if (wrapperDims[j][0] >= dims[0] && wrapperDims[j][1] >= dims[1] && wrapperDims[j][2] >= dims[2])
+					{
+						bitset[j >> 6] |= (uint64_t)1 << (j & 63);
+						indices.push_back(j);
+					}
+
+				bitsets.push_back(std::move(bitset));
+				feasibles.push_back(std::move(indices));
+			}
+		};
+
+		/**
+		 * @brief Construct from instances.
+		 *
+		 * @param wrapperArray Types of Wrapper.
+		 * @param instanceArray Instances to be wrapped.
+		 */
+		FeasibilityMatrix(std::shared_ptr<WrapperArray> wrapperArray, std::shared_ptr<InstanceArray> instanceArray)
+			: FeasibilityMatrix(wrapperArray, std::make_shared<InstanceTable>(instanceArray))
+		{
+		};
+
+		/* -----------------------------------------------------------
+			ACCESSORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get types of Wrapper.
+		 */
+		auto getWrapperArray() const -> std::shared_ptr<WrapperArray>
+		{
+			return wrapperArray;
+		};
+
+		/**
+		 * @brief Get distinct instances.
+		 */
+		auto getInstanceTable() const -> std::shared_ptr<InstanceTable>
+		{
+			return instanceTable;
+		};
+
+		/**
+		 * @brief Get index of a Wrapper.
+		 *
+		 * @details A Wrapper not in the WrapperArray (e.g. a copy) is identified by its key.
+		 *
+		 * @return Index of the Wrapper. -1 if not found.
+		 */
+		auto indexOf(const Wrapper &wrapper) const -> size_t
+		{
+			auto it = wrapperIndices.find(&wrapper);
+			if (it != wrapperIndices.end())
+				return it->second;
+
+			auto kit = keyIndices.find(wrapper.key());
+			if (kit != keyIndices.end())
+				return kit->second;
+			else
+				return (size_t)-1;
+		};
+
+		/**
+		 * @brief Get index of an Instance.
+		 *
+		 * @return SKU id of the instance. -1 if not found.
+		 */
+		auto indexOf(const Instance &instance) const -> size_t
+		{
+			return instanceTable->indexOf(instance);
+		};
+
+		/**
+		 * @brief Test whether a Wrapper can contain an Instance.
+		 *
+		 * @param wrapper Index of the Wrapper.
+		 * @param instance SKU id of the instance.
+		 */
+		auto feasible(size_t wrapper, size_t instance) const -> bool
+		{
+			return ((bitsets[instance][wrapper >> 6] >> (wrapper & 63)) & 1) != 0;
+		};
+
+		/**
+		 * @brief Get indices of Wrappers can contain an Instance.
+		 *
+		 * @param instance SKU id of the instance.
+		 */
+		auto getFeasibleWrappers(size_t instance) const -> const std::vector<size_t>&
+		{
+			return feasibles[instance];
+		};
+	};
+};
+};
@@ -0,0 +1,232 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <bws/packer/WrapperArray.hpp>
+#include <bws/packer/InstanceArray.hpp>
+#include <bws/packer/Product.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief Quantization of geometry, into integer units of a precision.
+	 *
+	 * @details
+	 * <p> Packing core compares dimensions and positions by equality; a sum of fractional dimensions (e.g.
+	 * 12.3 + 45.6) is not exactly same with the dimension of the other side in floating point, so that a
+	 * fitting space can be missed or a placement can be slightly over. FixedPoint encodes Wrappers and
+	 * Instances into integer multiples of a precision (e.g. 0.1 mm). Integers are represented exactly by
+	 * <i>double</i>, so that the packing core runs on exact values without being modified. </p>
+	 *
+	 * <p> Quantization is conservative. Dimensions of Instances are rounded up, and those of Wrappers are
+	 * rounded down, with their thickness rounded up. A packing in integer units is, thus, also a packing in
+	 * the caller's units. </p>
+	 *
+	 * <p> Result of the packing is decoded back to the caller's units by #decode(); Wrappers and Instances
+	 * of the result are the caller's objects and positions are multiplied by the precision. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class FixedPoint
+	{
+	private:
+		/**
+		 * @brief Tolerance of rounding, in units of the precision.
+		 */
+		static constexpr double EPSILON = 1e-6;
+
+		/**
+		 * @brief Length of a unit, in the caller's units.
+		 */
+		double precision;
+
+		/**
+		 * @brief Wrappers, in integer units.
+		 */
+		std::shared_ptr<WrapperArray> wrapperArray;
+
+		/**
+		 * @brief Instances, in integer units.
+		 */
+		std::shared_ptr<InstanceArray> instanceArray;
+
+		/**
+		 * @brief The caller's Wrappers, by indices of the encoded ones in #wrapperArray.
+		 */
+		std::vector<std::shared_ptr<Wrapper>> wrappers;
+
+		/**
+		 * @brief The caller's Instances, by addresses of the encoded ones.
+		 */
+		std::unordered_map<const Instance*, std::shared_ptr<Instance>> instances;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Construct from a precision and the caller's Wrappers and Instances.
+		 *
+		 * @details A distinct Instance is encoded once, so that the encoded InstanceArray repeats a same
+		 * object as the caller's one does.
+		 *
+		 * @param precision Length of a unit, in the caller's units.
+		 * @param wrapperArray Types of Wrapper.
+		 * @param instanceArray Instances to be packed.
+		 *
+		 * @throw invalid_argument The precision is not a positive number.
+		 */
+		FixedPoint(double precision, std::shared_ptr<WrapperArray> wrapperArray, std::shared_ptr<InstanceArray> instanceArray)
+		{
+			if (!(precision > 0.0) || std::isinf(precision))
+				throw std::invalid_argument("precision must be a positive number.");
+
+			this->precision = precision;
+			this->wrapperArray.reset(new WrapperArray());
+			this->instanceArray.reset(new InstanceArray());
+
+			// WRAPPERS; THE CONTAINABLE SPACE IS ROUNDED DOWN
+			for (size_t i = 0; i < wrapperArray->size(); i++)
+			{
+				const std::shared_ptr<Wrapper> &wrapper = wrapperArray->at(i);
+
+				this->wrapperArray->emplace_back(new Wrapper
+				(
+					wrapper->getName(), wrapper->getPrice(),
+					floor(wrapper->getWidth()), floor(wrapper->getHeight()), floor(wrapper->getLength()),
+					ceil(wrapper->getThickness())
+				));
+				wrappers.push_back(wrapper);
+			}
+
+			// INSTANCES; ROUNDED UP
+			std::unordered_map<const Instance*, std::shared_ptr<Instance>> encoded;
+
+			for (size_t i = 0; i < instanceArray->size(); i++)
+			{
+				const std::shared_ptr<Instance> &instance = instanceArray->at(i);
+				std::shared_ptr<Instance> &myInstance = encoded[instance.get()];
+
+				if (myInstance == nullptr)
+				{
+					myInstance.reset(new Product
+					(
+						instance->getName(),
+						ceil(instance->getWidth()), ceil(instance->getHeight()), ceil(instance->getLength())
+					));
+					instances.insert({ myInstance.get(), instance });
+				}
+				this->instanceArray->push_back(myInstance);
+			}
+		};
+
+		/* -----------------------------------------------------------
+			CONVERTERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Round a length down, into integer units.
+		 */
+		auto floor(double length) const -> double
+		{
+			return std::floor(length / precision + EPSILON);
+		};
+
+		/**
+		 * @brief Round a length up, into integer units.
+		 */
+		auto ceil(double length) const -> double
+		{
+			return std::ceil(length / precision - EPSILON);
+		};
+
+		/**
+		 * @brief Decode packed Wrappers into the caller's units.
+		 *
+		 * @param $wrappers Wrappers packed in integer units.
+		 * @return Copies of the caller's Wrappers, wrapping the caller's Instances.
+		 */
+		auto decode(std::shared_ptr<WrapperArray> $wrappers) const -> std::shared_ptr<WrapperArray>
+		{
+			std::shared_ptr<WrapperArray> result(new WrapperArray());
+			result->reserve($wrappers->size());
+
+			for (size_t i = 0; i < $wrappers->size(); i++)
+			{
+				const std::shared_ptr<Wrapper> &wrapper = $wrappers->at(i);
+				std::shared_ptr<Wrapper> myWrapper(new Wrapper(*wrappers.at(indexOf(*wrapper))));
+
+				for (size_t j = 0; j < wrapper->size(); j++)
+				{
+					const std::shared_ptr<Wrap> &wrap = wrapper->at(j);
+
+					myWrapper->emplace_back(new Wrap
+					(
+						myWrapper.get(), instances.at(wrap->getInstance().get()),
+						wrap->getX() * precision, wrap->getY() * precision, wrap->getZ() * precision,
+						wrap->getOrientation()
+					));
+				}
+				result->push_back(myWrapper);
+			}
+			return result;
+		};
+
+	private:
+		/**
+		 * @brief Get index of the encoded Wrapper, of which a packed Wrapper is a copy.
+		 *
+		 * @details Packed Wrappers are copies of the encoded ones. They're identified by their values, not
+		 * by keys only; Wrappers of a same name may differ in dimensions or price.
+		 *
+		 * @return Index in #wrapperArray.
+		 * @throw out_of_range The Wrapper is not encoded by this FixedPoint.
+		 */
+		auto indexOf(const Wrapper &wrapper) const -> size_t
+		{
+			for (size_t i = 0; i < wrapperArray->size(); i++)
+			{
+				const std::shared_ptr<Wrapper> &myWrapper = wrapperArray->at(i);
+
+				if (myWrapper.get() == &wrapper || (myWrapper->key() == wrapper.key() && myWrapper->operator==(wrapper)))
+					return i;
+			}
+			throw std::out_of_range("the wrapper is not encoded by the FixedPoint.");
+		};
+
+	public:
+		/* -----------------------------------------------------------
+			GETTERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get precision.
+		 */
+		auto getPrecision() const -> double
+		{
+			return precision;
+		};
+
+		/**
+		 * @brief Get Wrappers, in integer units.
+		 */
+		auto getWrapperArray() const -> std::shared_ptr<WrapperArray>
+		{
+			return wrapperArray;
+		};
+
+		/**
+		 * @brief Get Instances, in integer units.
+		 */
+		auto getInstanceArray() const -> std::shared_ptr<InstanceArray>
+		{
+			return instanceArray;
+		};
+	};
+};
+};
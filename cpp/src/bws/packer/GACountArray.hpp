@@ -0,0 +1,307 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <bws/packer/WrapperArray.hpp>
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <bws/packer/WrapperGroup.hpp>
+#include <bws/packer/WrapperGroupCache.hpp>
+#include <bws/packer/FeasibilityMatrix.hpp>
+#include <bws/packer/InstanceTable.hpp>
+#include <bws/packer/GAWrapperArray.hpp>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief Count matrix of Wrappers for each SKU.
+	 *
+	 * @details
+	 * <p> GACountArray is another representation of GAWrapperArray. Repeated units of a SKU are
+	 * interchangeable, so that sequence lists differ only in permutations of the units deduct same
+	 * {@link WrapperGroup groups}. Instead of a gene for each unit, GACountArray has a row for each SKU,
+	 * numbers of the units to be wrapped by each type of Wrapper. A row sums up to quantity of the SKU. </p>
+	 *
+	 * <p> Counts are stored in a contiguous array, [SKU][type of Wrapper]. SKUs are identified by their ids
+	 * in the InstanceTable and types by their indices in the WrapperArray, of a FeasibilityMatrix. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class GACountArray
+		: public std::vector<uint32_t>
+	{
+	private:
+		typedef std::vector<uint32_t> super;
+
+	protected:
+		/**
+		 * @brief Feasibility of Wrappers for the SKUs.
+		 *
+		 * @details Shared by all copies of the count matrix.
+		 */
+		std::shared_ptr<FeasibilityMatrix> feasibility;
+
+		/**
+		 * @brief Memo of optimized WrapperGroup objects.
+		 *
+		 * @details Shared by all copies of the count matrix.
+		 */
+		std::shared_ptr<WrapperGroupCache> cache;
+
+		/**
+		 * @brief Type of PackingEngine of the groups.
+		 */
+		int engine;
+
+		/**
+		 * @brief Token of the optimization in progress, given to the groups.
+		 */
+		const CancelToken *cancelToken;
+
+		std::unordered_map<std::string, std::shared_ptr<WrapperGroup>> result;
+
+		/**
+		 * @brief Keys of the groups in #result.
+		 */
+		std::unordered_map<std::string, WrapperGroupCache::Key> keyMap;
+
+		/**
+		 * @brief Groups inherited from the parent.
+		 *
+		 * @details Same with GAWrapperArray::heritage.
+		 */
+		std::unordered_map<std::string, std::pair<WrapperGroupCache::Key, std::shared_ptr<WrapperGroup>>> heritage;
+
+		/**
+		 * @brief Price of this count matrix.
+		 */
+		double price;
+
+		/**
+		 * @brief Validity of this count matrix.
+		 */
+		bool valid;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Construct from a sequence list.
+		 *
+		 * @details Counts Wrappers of the genes for each SKU. If the sequence list has no FeasibilityMatrix,
+		 * it's built from the list's own types of Wrapper and InstanceTable, by which the SKUs are identified.
+		 *
+		 * @param geneArray A sequence list.
+		 */
+		GACountArray(const GAWrapperArray &geneArray)
+			: super(geneArray.getInstanceTable()->size() * geneArray.getWrapperArray()->size(), 0)
+		{
+			feasibility = geneArray.getFeasibility();
+			if (feasibility == nullptr)
+				feasibility.reset(new FeasibilityMatrix(geneArray.getWrapperArray(), geneArray.getInstanceTable()));
+
+			cache.reset(new WrapperGroupCache());
+			engine = geneArray.getEngine();
+			cancelToken = geneArray.getCancelToken();
+
+			valid = true;
+			price = 0.0;
+
+			for (size_t i = 0; i < geneArray.size(); i++)
+				at(geneArray.getSKU(i) * types() + geneArray.at(i))++;
+		};
+
+		/**
+		 * @brief Copy Constructor.
+		 *
+		 * @details Copies counts, shares the memo of optimized WrapperGroup objects and inherits optimized
+		 * groups of the <i>obj</i>, if the <i>obj</i> has constructed its result.
+		 */
+		GACountArray(const GACountArray &obj)
+			: super(obj)
+		{
+			feasibility = obj.feasibility;
+			cache = obj.cache;
+			engine = obj.engine;
+			cancelToken = obj.cancelToken;
+
+			valid = true;
+			price = 0.0;
+
+			for (auto it = obj.keyMap.begin(); it != obj.keyMap.end(); it++)
+				heritage.insert({ it->first, { it->second, obj.result.at(it->first) } });
+		};
+
+		virtual ~GACountArray() = default;
+
+		/**
+		 * @brief Construct result, by packing process.
+		 *
+		 * @details
+		 * <p> Units of a SKU are allocated to a WrapperGroup at once, by its count. Key of a group in the
+		 * memo is a list of pairs; SKU id and count, in order of SKU id. </p>
+		 *
+		 * <p> Result is constructed only once. Repeated calls do nothing. </p>
+		 */
+		void constructResult()
+		{
+			if (result.empty() == false)
+				return;
+
+			const std::shared_ptr<WrapperArray> &wrapperArray = feasibility->getWrapperArray();
+			const std::shared_ptr<InstanceTable> &instanceTable = feasibility->getInstanceTable();
+
+			// KEYS OF THE GROUPS, FOR EACH TYPE
+			std::unordered_map<std::string, WrapperGroupCache::Key> keys;
+			std::vector<WrapperGroupCache::Key*> typeKeys(types(), nullptr);
+
+			for (size_t sku = 0; sku < skus(); sku++)
+				for (size_t type = 0; type < types(); type++)
+				{
+					uint32_t count = at(sku * types() + type);
+					if (count == 0)
+						continue;
+
+					if (feasibility->feasible(type, sku) == false)
+					{
+						valid = false;
+						heritage.clear();
+						return;
+					}
+
+					if (typeKeys[type] == nullptr)
+					{
+						std::string key = wrapperArray->at(type)->key();
+						if (result.count(key) == 0)
+						{
+							std::shared_ptr<WrapperGroup> wrapperGroup(new WrapperGroup(wrapperArray->at(type)));
+							wrapperGroup->setEngine(engine);
+
+							result.insert({ key, wrapperGroup });
+						}
+
+						typeKeys[type] = &keys[key];
+						typeKeys[type]->wrapper = key;
+					}
+					typeKeys[type]->instances.push_back(sku);
+					typeKeys[type]->instances.push_back(count);
+				}
+
+			for (auto it = result.begin(); it != result.end(); it++)
+			{
+				WrapperGroupCache::Key &key = keys[it->first];
+
+				// TYPES OF SAME KEY; SKUS TO BE IN ORDER
+				std::vector<std::pair<size_t, size_t>> pairs;
+				for (size_t i = 0; i < key.instances.size(); i += 2)
+					pairs.emplace_back(key.instances[i], key.instances[i + 1]);
+
+				std::stable_sort(pairs.begin(), pairs.end(), [](const std::pair<size_t, size_t> &x, const std::pair<size_t, size_t> &y) -> bool
+					{
+						return x.first < y.first;
+					});
+
+				for (size_t i = 0; i < pairs.size(); i++)
+				{
+					key.instances[i * 2] = pairs[i].first;
+					key.instances[i * 2 + 1] = pairs[i].second;
+				}
+
+				// REUSE THE INHERITED OR MEMOIZED GROUP
+				auto inherited = heritage.find(it->first);
+				std::shared_ptr<WrapperGroup> wrapperGroup = nullptr;
+
+				if (inherited != heritage.end() && inherited->second.first == key)
+					wrapperGroup = inherited->second.second;
+				else
+					wrapperGroup = cache->get(key);
+
+				if (wrapperGroup != nullptr)
+					it->second = wrapperGroup;
+				else
+				{
+					wrapperGroup = it->second;
+					for (size_t i = 0; i < pairs.size(); i++)
+						wrapperGroup->allocateFeasible(instanceTable, pairs[i].first, pairs[i].second);
+
+					wrapperGroup->optimize(cancelToken);
+					cache->insert(key, wrapperGroup);
+				}
+				price += it->second->getPrice();
+				keyMap.insert({ it->first, std::move(key) });
+			}
+			heritage.clear();
+			valid = true;
+		};
+
+	public:
+		/* -----------------------------------------------------------
+			GETTERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get number of SKUs; rows of the matrix.
+		 */
+		auto skus() const -> size_t
+		{
+			return types() == 0 ? 0 : size() / types();
+		};
+
+		/**
+		 * @brief Get number of types of Wrapper; columns of the matrix.
+		 */
+		auto types() const -> size_t
+		{
+			return feasibility->getWrapperArray()->size();
+		};
+
+		/**
+		 * @brief Get feasibility of Wrappers for the SKUs.
+		 */
+		auto getFeasibility() const -> std::shared_ptr<FeasibilityMatrix>
+		{
+			return feasibility;
+		};
+
+		/**
+		 * @brief Get optimization result.
+		 *
+		 * @return Const reference of result map.
+		 */
+		auto getResult() const -> const std::unordered_map<std::string, std::shared_ptr<WrapperGroup>>&
+		{
+			((GACountArray*)this)->constructResult();
+
+			return result;
+		};
+
+		/**
+		 * @brief Get fitness.
+		 *
+		 * @return Price of this count matrix, or infinity if it's not valid. The lower, the better.
+		 */
+		auto getFitness() const -> double
+		{
+			((GACountArray*)this)->constructResult();
+
+			if (valid == true)
+				return price;
+			else
+				return std::numeric_limits<double>::infinity();
+		};
+
+		/**
+		 * @brief Whether this count matrix is inferior?
+		 */
+		auto operator<(const GACountArray &obj) const -> bool
+		{
+			return getFitness() < obj.getFitness();
+		};
+	};
+};
+};
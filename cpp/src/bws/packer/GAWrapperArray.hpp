@@ -3,9 +3,16 @@
 
 #include <bws/packer/WrapperArray.hpp>
 
+#include <vector>
 #include <unordered_map>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
 #include <bws/packer/WrapperGroup.hpp>
+#include <bws/packer/WrapperGroupCache.hpp>
+#include <bws/packer/FeasibilityMatrix.hpp>
 #include <bws/packer/InstanceArray.hpp>
+#include <bws/packer/InstanceTable.hpp>
 
 namespace bws
 {
@@ -14,22 +21,97 @@ namespace packer
 	/**
 	 * @brief Sequence list of Wrapper objects.
 	 *
+	 * @details
+	 * <p> A gene is type of the Wrapper to wrap an instance, which is encoded as an index in the #wrapperArray.
+	 * Genes are stored contiguously, 2 bytes for each, instead of shared pointers to the Wrappers. Thus
+	 * copies, crossovers and mutations of sequence lists are done by plain integer operations. </p>
+	 *
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	class GAWrapperArray
-		: public WrapperArray
+		: public std::vector<uint16_t>
 	{
 	private:
-		typedef WrapperArray super;
+		typedef std::vector<uint16_t> super;
 
 	protected:
 		/**
-		 * @brief Instance objects to be wrapped.
+		 * @brief Types of Wrapper, indexed by the genes.
+		 *
+		 * @details Shared by all copies of the sequence list.
+		 */
+		std::shared_ptr<WrapperArray> wrapperArray;
+
+		/**
+		 * @brief Distinct instances to be wrapped.
+		 *
+		 * @details Shared by all copies of the sequence list.
 		 */
-		std::shared_ptr<InstanceArray> instanceArray;
+		std::shared_ptr<InstanceTable> instanceTable;
+
+		/**
+		 * @brief SKU ids of the instances, to be wrapped by each gene.
+		 *
+		 * @details Shared by all copies of the sequence list.
+		 */
+		std::shared_ptr<std::vector<uint32_t>> skus;
+
+		/**
+		 * @brief Ranks of the SKUs.
+		 *
+		 * @details Rank of a SKU is index of its first occurence in the #skus. It's shared by all copies of 
+		 * the sequence list.
+		 */
+		std::shared_ptr<std::vector<uint32_t>> ranks;
+
+		/**
+		 * @brief Feasibility of Wrappers for the instances.
+		 *
+		 * @details Shared by all copies of the sequence list. nullptr if not given; then feasibility is 
+		 * tested by Wrapper::operator>=().
+		 */
+		std::shared_ptr<FeasibilityMatrix> feasibility;
+
+		/**
+		 * @brief Memo of optimized WrapperGroup objects.
+		 *
+		 * @details Shared by all copies of the sequence list.
+		 */
+		std::shared_ptr<WrapperGroupCache> cache;
+
+		/**
+		 * @brief Type of PackingEngine of the groups.
+		 *
+		 * @details Copied by all copies of the sequence list.
+		 */
+		int engine;
+
+		/**
+		 * @brief Token of the optimization in progress, given to the groups.
+		 *
+		 * @details Copied by all copies of the sequence list. nullptr if not cancelable.
+		 */
+		const CancelToken *cancelToken;
 		
 		std::unordered_map<std::string, std::shared_ptr<WrapperGroup>> result;
 
+		/**
+		 * @brief Keys of the groups in #result.
+		 */
+		std::unordered_map<std::string, WrapperGroupCache::Key> keyMap;
+
+		/**
+		 * @brief Groups inherited from the parent.
+		 *
+		 * @details
+		 * <p> Optimized groups of the parent sequence list with their keys, copied by the copy constructor.
+		 * A group whose instances are not changed by crossover or mutation is reused without re-packing 
+		 * and without accessing the #cache. </p>
+		 *
+		 * <p> It's released after the #result is constructed. </p>
+		 */
+		std::unordered_map<std::string, std::pair<WrapperGroupCache::Key, std::shared_ptr<WrapperGroup>>> heritage;
+
 		/**
 		 * @brief Price of this sequence list.
 		 *
@@ -49,73 +131,286 @@ namespace packer
 			CONSTRUCTORS
 		----------------------------------------------------------- */
 		/**
-		 * @brief Construct from instances.
+		 * @brief Construct from types of Wrapper and instances.
 		 *
+		 * @param wrapperArray Types of Wrapper, indexed by the genes.
 		 * @param instanceArray Instances to be wrapped.
 		 */
-		GAWrapperArray(std::shared_ptr<InstanceArray> instanceArray)
+		GAWrapperArray(std::shared_ptr<WrapperArray> wrapperArray, std::shared_ptr<InstanceArray> instanceArray)
 			: super()
 		{
-			this->instanceArray = instanceArray;
-			valid = true;
-			price = 0.0;
+			this->wrapperArray = wrapperArray;
+			construct(instanceArray, nullptr);
+		};
+
+		/**
+		 * @brief Construct from instances and feasibility.
+		 *
+		 * @details Genes are indices in the WrapperArray of the <i>feasibility</i>. The instances are 
+		 * represented by SKU ids in the InstanceTable of the <i>feasibility</i>. If an instance is not in the
+		 * table, the <i>feasibility</i> is not used to test the instances.
+		 *
+		 * @param instanceArray Instances to be wrapped.
+		 * @param feasibility Feasibility of Wrappers for the instances.
+		 */
+		GAWrapperArray(std::shared_ptr<InstanceArray> instanceArray, std::shared_ptr<FeasibilityMatrix> feasibility)
+			: super()
+		{
+			this->wrapperArray = feasibility->getWrapperArray();
+			construct(instanceArray, feasibility);
 		};
 		
 		/**
 		 * @brief Copy Constructor.
+		 *
+		 * @details Copies genes, shares the memo of optimized WrapperGroup objects and inherits optimized
+		 * groups of the <i>obj</i>, if the <i>obj</i> has constructed its result.
 		 */
 		GAWrapperArray(const GAWrapperArray &obj)
-			: GAWrapperArray(obj.instanceArray)
+			: super(obj)
 		{
-			assign(obj.begin(), obj.end());
+			wrapperArray = obj.wrapperArray;
+			instanceTable = obj.instanceTable;
+			skus = obj.skus;
+			ranks = obj.ranks;
+			feasibility = obj.feasibility;
+			cache = obj.cache;
+			engine = obj.engine;
+			cancelToken = obj.cancelToken;
+
+			valid = true;
+			price = 0.0;
+
+			for (auto it = obj.keyMap.begin(); it != obj.keyMap.end(); it++)
+				heritage.insert({ it->first, { it->second, obj.result.at(it->first) } });
 		};
 
 		virtual ~GAWrapperArray() = default;
 
-	protected:
+	private:
+		/**
+		 * @brief Construct SKU ids and their ranks, of the instances.
+		 */
+		void construct(std::shared_ptr<InstanceArray> instanceArray, std::shared_ptr<FeasibilityMatrix> feasibility)
+		{
+			valid = true;
+			price = 0.0;
+
+			// SKU IDS OF INSTANCES
+			if (feasibility != nullptr)
+			{
+				this->feasibility = feasibility;
+				this->instanceTable = feasibility->getInstanceTable();
+
+				for (size_t i = 0; i < instanceArray->size(); i++)
+					if (instanceTable->indexOf(*instanceArray->at(i)) == (size_t)-1)
+					{
+						this->feasibility = nullptr;
+						this->instanceTable = nullptr;
+						break;
+					}
+			}
+			if (instanceTable == nullptr)
+				instanceTable.reset(new InstanceTable(instanceArray));
+
+			skus.reset(new std::vector<uint32_t>(instanceTable->indexOf(*instanceArray)));
+
+			// RANKS OF SKUS
+			ranks.reset(new std::vector<uint32_t>(instanceTable->size(), UINT32_MAX));
+			for (size_t i = 0; i < skus->size(); i++)
+				if (ranks->at(skus->at(i)) == UINT32_MAX)
+					ranks->at(skus->at(i)) = (uint32_t)i;
+
+			cache.reset(new WrapperGroupCache());
+			engine = PackingEngine::BOXOLOGIC;
+			cancelToken = nullptr;
+		};
+
+	public:
 		/**
 		 * @brief Construct result, by packing process.
+		 *
+		 * @details Result is constructed only once. Repeated calls do nothing.
+		 *
+		 * <p> Groups are optimized with the #cancelToken; if it's expired, the result is still valid but
+		 * less optimized. </p>
 		 */
 		void constructResult()
 		{
 			if (result.empty() == false)
 				return;
 
+			std::unordered_map<std::string, std::vector<size_t>> indexMap;
+
+			// INDICES OF GENES FOR EACH TYPE; KEY OF A TYPE IS COMPUTED ONCE
+			std::vector<std::vector<size_t>*> typeIndices(wrapperArray->size(), nullptr);
+
 			// ǰ  ׷, Product WrapperGroup 1:1 Ī
 			for (size_t i = 0; i < size(); i++)
 			{
-				const std::shared_ptr<Wrapper> &wrapper = at(i);
-				if (result.count(wrapper->key()) == 0)
+				size_t type = at(i);
+				if (typeIndices[type] == nullptr)
 				{
-					WrapperGroup *wrapperGroup = new WrapperGroup(wrapper);
-					result.insert({ wrapper->key(), std::shared_ptr<WrapperGroup>(wrapperGroup) });
-				}
+					const std::shared_ptr<Wrapper> &wrapper = wrapperArray->at(type);
+					std::string key = wrapper->key();
 
-				std::shared_ptr<WrapperGroup> wrapperGroup = result.at(wrapper->key());
-				std::shared_ptr<Instance> instance = instanceArray->at(i);
+					if (result.count(key) == 0)
+					{
+						WrapperGroup *wrapperGroup = new WrapperGroup(wrapper);
+						wrapperGroup->setEngine(engine);
 
-				if (wrapperGroup->allocate(instance) == false)
+						result.insert({ key, std::shared_ptr<WrapperGroup>(wrapperGroup) });
+					}
+					typeIndices[type] = &indexMap[key];
+				}
+
+				if (isFeasible(i) == false)
 				{
 					// ϰ ǰ ũⰡ  Ŀ    , 
 					//  ⼭ ȿ Ͽ 
 					valid = false;
+					heritage.clear();
 					return;
 				}
+				typeIndices[type]->push_back(i);
 			}
 
 			// ȿ ⼭ ,
 			for (auto it = result.begin(); it != result.end(); it++)
 			{
-				it->second->optimize(); // (׷캰) bin-packing ǽ
+				std::vector<size_t> &indices = indexMap[it->first];
+
+				// CANONICAL ORDER OF THE INSTANCES: BY RANK
+				std::stable_sort(indices.begin(), indices.end(), [this](size_t x, size_t y) -> bool
+					{
+						return rankOf(x) < rankOf(y);
+					});
+
+				WrapperGroupCache::Key key;
+				key.wrapper = it->first;
+				key.instances.reserve(indices.size());
+
+				for (size_t i = 0; i < indices.size(); i++)
+					key.instances.push_back(rankOf(indices[i]));
+
+				// θκ  ׷  ʾҴٸ ״ 
+				auto inherited = heritage.find(it->first);
+				std::shared_ptr<WrapperGroup> wrapperGroup = nullptr;
+
+				if (inherited != heritage.end() && inherited->second.first == key)
+					wrapperGroup = inherited->second.second;
+				else // ̹ ȭ ׷ ִٸ 
+					wrapperGroup = cache->get(key);
+
+				if (wrapperGroup != nullptr)
+					it->second = wrapperGroup;
+				else
+				{
+					wrapperGroup = it->second;
+					for (size_t i = 0; i < indices.size(); i++)
+						wrapperGroup->allocateFeasible(instanceTable, skus->at(indices[i]));
+
+					wrapperGroup->optimize(cancelToken); // (׷캰) bin-packing ǽ
+					cache->insert(key, wrapperGroup);
+				}
 				price += it->second->getPrice(); // Ҿ ݵ ջصд
+				keyMap.insert({ it->first, std::move(key) });
 			}
+			heritage.clear();
 			valid = true;
 		};
 
+	private:
+		/**
+		 * @brief Get rank of the instance of a gene.
+		 *
+		 * @param index Index of the gene.
+		 */
+		auto rankOf(size_t index) const -> size_t
+		{
+			return ranks->at(skus->at(index));
+		};
+
+		/**
+		 * @brief Test whether the Wrapper of a gene can contain its instance.
+		 *
+		 * @param index Index of the gene.
+		 */
+		auto isFeasible(size_t index) const -> bool
+		{
+			if (feasibility != nullptr)
+				return feasibility->feasible(at(index), skus->at(index));
+			else
+				return getWrapper(index)->operator>=(*instanceTable->getInstance(skus->at(index)));
+		};
+
 	public:
 		/* -----------------------------------------------------------
 			GETTERS
 		----------------------------------------------------------- */
+		/**
+		 * @brief Get types of Wrapper, indexed by the genes.
+		 */
+		auto getWrapperArray() const -> std::shared_ptr<WrapperArray>
+		{
+			return wrapperArray;
+		};
+
+		/**
+		 * @brief Get Wrapper of a gene.
+		 *
+		 * @param index Index of the gene.
+		 */
+		auto getWrapper(size_t index) const -> const std::shared_ptr<Wrapper>&
+		{
+			return wrapperArray->at(at(index));
+		};
+
+		/**
+		 * @brief Get feasibility of Wrappers for the instances.
+		 *
+		 * @return The feasibility. nullptr if not given.
+		 */
+		auto getFeasibility() const -> std::shared_ptr<FeasibilityMatrix>
+		{
+			return feasibility;
+		};
+
+		/**
+		 * @brief Get distinct instances to be wrapped.
+		 */
+		auto getInstanceTable() const -> std::shared_ptr<InstanceTable>
+		{
+			return instanceTable;
+		};
+
+		/**
+		 * @brief Get SKU id of the instance of a gene.
+		 *
+		 * @param index Index of the gene.
+		 * @return SKU id of the instance, in #getInstanceTable() and #getFeasibility().
+		 */
+		auto getSKU(size_t index) const -> size_t
+		{
+			return skus->at(index);
+		};
+
+		/**
+		 * @brief Get type of PackingEngine of the groups.
+		 */
+		auto getEngine() const -> int
+		{
+			return engine;
+		};
+
+		/**
+		 * @brief Get token of the optimization in progress.
+		 */
+		auto getCancelToken() const -> const CancelToken*
+		{
+			return cancelToken;
+		};
+
 		/**
 		 * @brief Get optimization result.
 		 *
@@ -128,6 +423,21 @@ namespace packer
 			return result;
 		};
 
+		/**
+		 * @brief Get fitness.
+		 *
+		 * @return Price of this sequence list, or infinity if it's not valid. The lower, the better.
+		 */
+		auto getFitness() const -> double
+		{
+			((GAWrapperArray*)this)->constructResult();
+
+			if (valid == true)
+				return price;
+			else
+				return std::numeric_limits<double>::infinity();
+		};
+
 		/**
 		 * @brief Whether this sequence list is inferior?
 		 */
@@ -149,6 +459,30 @@ namespace packer
 			else
 				return false;
 		};
+
+		/* -----------------------------------------------------------
+			SETTERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Set type of PackingEngine of the groups.
+		 *
+		 * @details The engine must be set before the result is constructed.
+		 */
+		void setEngine(int val)
+		{
+			engine = val;
+		};
+
+		/**
+		 * @brief Set token of the optimization in progress.
+		 *
+		 * @details The token must outlive the sequence list and its copies, while they're constructing
+		 * their results.
+		 */
+		void setCancelToken(const CancelToken *val)
+		{
+			cancelToken = val;
+		};
 	};
 };
 };
\ No newline at end of file
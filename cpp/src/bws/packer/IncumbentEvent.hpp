@@ -0,0 +1,135 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <samchon/library/Event.hpp>
+#include <bws/packer/WrapperArray.hpp>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief Event of an improved solution, during the optimization.
+	 *
+	 * @details
+	 * <p> In the anytime mode of Packer, an IncumbentEvent is delivered whenever a solution strictly
+	 * cheaper than the previous one is found; the greedy solution first, and then improvements by the
+	 * genetic algorithm. A client can take the first one as a quick quote and replace it by later ones. </p>
+	 *
+	 * <p> The solution is complete; in the caller's units and sorted, same with a result of
+	 * Packer::optimize(). Deltas are differences from the previous incumbent, zero for the first one. </p>
+	 *
+	 * <p> Incumbents are delivered to the {@link Packer::setIncumbentListener listener} synchronously, on the
+	 * thread of Packer::optimize(), in order of their {@link #getSequence sequence numbers}. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class IncumbentEvent
+		: public library::Event
+	{
+	private:
+		typedef library::Event super;
+
+	protected:
+		/**
+		 * @brief The solution.
+		 */
+		std::shared_ptr<WrapperArray> wrapperArray;
+
+		/**
+		 * @brief Sequence number of the incumbent in an optimization; 1 for the first one.
+		 */
+		size_t sequence;
+
+		double price;
+		double utilization;
+
+		double priceDelta;
+		double utilizationDelta;
+
+	public:
+		enum : int
+		{
+			INCUMBENT = 21
+		};
+
+		/**
+		 * @brief Construct from source and the solution.
+		 *
+		 * @param source Source of the event, a Packer.
+		 * @param wrapperArray The solution.
+		 * @param previous The previous incumbent. nullptr if the solution is the first one.
+		 */
+		IncumbentEvent(library::EventDispatcher *source, std::shared_ptr<WrapperArray> wrapperArray, const IncumbentEvent *previous)
+			: super(source, IncumbentEvent::INCUMBENT)
+		{
+			this->wrapperArray = wrapperArray;
+
+			price = wrapperArray->getPrice();
+			utilization = wrapperArray->getUtilization();
+
+			if (previous == nullptr)
+			{
+				sequence = 1;
+				priceDelta = 0.0;
+				utilizationDelta = 0.0;
+			}
+			else
+			{
+				sequence = previous->sequence + 1;
+				priceDelta = price - previous->price;
+				utilizationDelta = utilization - previous->utilization;
+			}
+		};
+		virtual ~IncumbentEvent() = default;
+
+		/**
+		 * @brief Get the solution.
+		 */
+		auto getWrapperArray() const -> std::shared_ptr<WrapperArray>
+		{
+			return wrapperArray;
+		};
+
+		/**
+		 * @brief Get sequence number of the incumbent; 1 for the first one.
+		 */
+		auto getSequence() const -> size_t
+		{
+			return sequence;
+		};
+
+		/**
+		 * @brief Get price of the solution.
+		 */
+		auto getPrice() const -> double
+		{
+			return price;
+		};
+
+		/**
+		 * @brief Get utilization of the solution.
+		 */
+		auto getUtilization() const -> double
+		{
+			return utilization;
+		};
+
+		/**
+		 * @brief Get difference of price from the previous incumbent; negative, or zero for the first one.
+		 */
+		auto getPriceDelta() const -> double
+		{
+			return priceDelta;
+		};
+
+		/**
+		 * @brief Get difference of utilization from the previous incumbent.
+		 */
+		auto getUtilizationDelta() const -> double
+		{
+			return utilizationDelta;
+		};
+	};
+};
+};
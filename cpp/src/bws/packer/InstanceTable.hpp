@@ -0,0 +1,167 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <bws/packer/InstanceArray.hpp>
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief A table of interned instances.
+	 *
+	 * @details
+	 * <p> An InstanceArray repeats a same Instance object as many as its quantity, each of them referenced by
+	 * a shared pointer. InstanceTable interns the distinct objects; each one is stored once and identified by
+	 * a small integer, a SKU id, in order of registration. Its dimensions are stored in a plain Record, so
+	 * that a list of instances can be represented by an array of SKU ids, without copying shared pointers
+	 * and without accessing the objects. </p>
+	 *
+	 * <p> The Instance object itself (with its name) is kept once for each SKU, to construct Wrap objects
+	 * of the result. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class InstanceTable
+	{
+	public:
+		/**
+		 * @brief Dimensions of a SKU.
+		 */
+		struct Record
+		{
+			double width;
+			double height;
+			double length;
+			double volume;
+		};
+
+	private:
+		/**
+		 * @brief The distinct instances, by their SKU ids.
+		 */
+		std::vector<std::shared_ptr<Instance>> instances;
+
+		/**
+		 * @brief Dimensions of the distinct instances, by their SKU ids.
+		 */
+		std::vector<Record> records;
+
+		/**
+		 * @brief SKU ids of the distinct instances, by their addresses.
+		 */
+		std::unordered_map<const Instance*, uint32_t> indices;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Default Constructor.
+		 */
+		InstanceTable() = default;
+
+		/**
+		 * @brief Construct from instances.
+		 *
+		 * @details Distinct instances are registered in order of their first occurences.
+		 *
+		 * @param instanceArray Instances to be interned.
+		 */
+		InstanceTable(std::shared_ptr<InstanceArray> instanceArray)
+		{
+			for (size_t i = 0; i < instanceArray->size(); i++)
+				intern(instanceArray->at(i));
+		};
+
+		/**
+		 * @brief Intern an instance.
+		 *
+		 * @param instance An instance to be interned.
+		 * @return SKU id of the instance. If it's registered already, the previous id.
+		 */
+		auto intern(const std::shared_ptr<Instance> &instance) -> uint32_t
+		{
+			auto pair = indices.insert({ instance.get(), (uint32_t)instances.size() });
+			if (pair.second == true)
+			{
+				Record record;
+				record.width = instance->getWidth();
+				record.height = instance->getHeight();
+				record.length = instance->getLength();
+				record.volume = instance->getVolume();
+
+				instances.push_back(instance);
+				records.push_back(record);
+			}
+			return pair.first->second;
+		};
+
+		/* -----------------------------------------------------------
+			ACCESSORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get number of SKUs.
+		 */
+		auto size() const -> size_t
+		{
+			return records.size();
+		};
+
+		/**
+		 * @brief Get SKU id of an instance.
+		 *
+		 * @return SKU id of the instance. -1 if not registered.
+		 */
+		auto indexOf(const Instance &instance) const -> size_t
+		{
+			auto it = indices.find(&instance);
+			if (it != indices.end())
+				return it->second;
+			else
+				return (size_t)-1;
+		};
+
+		/**
+		 * @brief Get dimensions of a SKU.
+		 *
+		 * @param sku SKU id.
+		 */
+		auto at(size_t sku) const -> const Record&
+		{
+			return records[sku];
+		};
+
+		/**
+		 * @brief Get instance of a SKU.
+		 *
+		 * @param sku SKU id.
+		 */
+		auto getInstance(size_t sku) const -> const std::shared_ptr<Instance>&
+		{
+			return instances[sku];
+		};
+
+		/**
+		 * @brief Get SKU ids of instances.
+		 *
+		 * @param instanceArray Instances, all of them registered.
+		 * @return SKU ids of the instances, in same order.
+		 */
+		auto indexOf(const InstanceArray &instanceArray) const -> std::vector<uint32_t>
+		{
+			std::vector<uint32_t> skus;
+			skus.reserve(instanceArray.size());
+
+			for (size_t i = 0; i < instanceArray.size(); i++)
+				skus.push_back((uint32_t)indexOf(*instanceArray.at(i)));
+
+			return skus;
+		};
+	};
+};
+};
@@ -0,0 +1,157 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <samchon/library/GeneticAlgorithm.hpp>
+
+#include <bws/packer/GACountArray.hpp>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief A genetic algorithm of count matrices, GACountArray.
+	 *
+	 * @details
+	 * <p> Operators of PCKCountGeneticAlgorithm keep each row of a GACountArray summing up to quantity of
+	 * the SKU, and draw only Wrappers can contain the SKU. </p>
+	 *
+	 * <ul>
+	 *	<li> Diversification: each unit of a SKU is assigned to a feasible Wrapper randomly. </li>
+	 *	<li> Crossover: each row is taken from either of the parents uniformly. </li>
+	 *	<li> Mutation: each unit moves to a random feasible Wrapper, by the mutation rate. </li>
+	 * </ul>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class PCKCountGeneticAlgorithm
+		: public library::GeneticAlgorithm<GACountArray>
+	{
+	private:
+		typedef library::GeneticAlgorithm<GACountArray> super;
+
+	public:
+		/**
+		 * @brief Construct from parameters
+		 *
+		 * @param gaParams Parameters of the genetic algorithm
+		 */
+		PCKCountGeneticAlgorithm(const library::GAParameters &gaParams)
+			: super(false, gaParams)
+		{
+		};
+
+	protected:
+		/**
+		 * @brief Assign each unit of the SKUs to a random feasible Wrapper.
+		 */
+		virtual void diversify(std::shared_ptr<GACountArray> individual, Engine &engine) const override
+		{
+			size_t types = individual->types();
+
+			for (size_t sku = 0; sku < individual->skus(); sku++)
+			{
+				const std::vector<size_t> &feasibles = individual->getFeasibility()->getFeasibleWrappers(sku);
+				uint32_t *row = &individual->at(sku * types);
+
+				uint32_t quantity = 0;
+				for (size_t t = 0; t < types; t++)
+				{
+					quantity += row[t];
+					row[t] = 0;
+				}
+
+				if (quantity == 0 || feasibles.empty() == true)
+					continue;
+
+				for (uint32_t k = 0; k < quantity; k++)
+					row[draw(feasibles, engine)]++;
+			}
+		};
+
+		/**
+		 * @brief Take each row from either of the parents.
+		 */
+		virtual auto crossover(const std::shared_ptr<GACountArray> &parent1, const std::shared_ptr<GACountArray> &parent2, Engine &engine) const -> std::shared_ptr<GACountArray> override
+		{
+			std::shared_ptr<GACountArray> individual(new GACountArray(*parent1));
+			size_t types = individual->types();
+
+			for (size_t sku = 0; sku < individual->skus(); sku++)
+				if (random(engine) > .5)
+					std::copy
+					(
+						parent2->begin() + sku * types, parent2->begin() + (sku + 1) * types,
+						individual->begin() + sku * types
+					);
+
+			return individual;
+		};
+
+		/**
+		 * @brief Move each unit to a random feasible Wrapper, by the mutation rate.
+		 */
+		virtual void mutate(std::shared_ptr<GACountArray> individual, Engine &engine) const override
+		{
+			size_t types = individual->types();
+			std::vector<uint32_t> moves(types, 0);
+
+			for (size_t sku = 0; sku < individual->skus(); sku++)
+			{
+				const std::vector<size_t> &feasibles = individual->getFeasibility()->getFeasibleWrappers(sku);
+				uint32_t *row = &individual->at(sku * types);
+
+				if (feasibles.empty() == true)
+					continue;
+
+				// MOVE UNITS, AND THEN ADD THEM; A MOVED UNIT DOESN'T MUTATE AGAIN
+				for (size_t t = 0; t < types; t++)
+				{
+					uint32_t count = row[t];
+					for (uint32_t k = 0; k < count; k++)
+					{
+						if (random(engine) > mutationRate)
+							continue;
+
+						row[t]--;
+						moves[draw(feasibles, engine)]++;
+					}
+				}
+
+				for (size_t t = 0; t < types; t++)
+				{
+					row[t] += moves[t];
+					moves[t] = 0;
+				}
+			}
+		};
+
+		/**
+		 * @brief Evaluate a count matrix.
+		 *
+		 * @return Fitness of the count matrix.
+		 */
+		virtual auto evaluate(std::shared_ptr<GACountArray> individual) const -> double override
+		{
+			return individual->getFitness();
+		};
+
+	private:
+		/**
+		 * @brief Draw a Wrapper randomly.
+		 *
+		 * @param feasibles Indices of Wrappers to draw.
+		 * @param engine A random engine.
+		 * @return Index of the drawn Wrapper.
+		 */
+		static auto draw(const std::vector<size_t> &feasibles, Engine &engine) -> size_t
+		{
+			size_t index = (size_t)(random(engine) * feasibles.size());
+			if (index == feasibles.size())
+				index--;
+
+			return feasibles[index];
+		};
+	};
+};
+};
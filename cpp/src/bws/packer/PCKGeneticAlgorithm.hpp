@@ -30,6 +30,8 @@ namespace packer
 
 		/**
 		 * @brief Candidate wrappers of mutation.
+		 *
+		 * @details Same with GAWrapperArray::getWrapperArray(); a gene mutates to an index of the candidates.
 		 */
 		std::shared_ptr<WrapperArray> candidates;
 
@@ -47,6 +49,18 @@ namespace packer
 			this->candidates = candidates;
 		};
 
+		/**
+		 * @brief Construct from parameters
+		 *
+		 * @param gaParams Parameters of the genetic algorithm
+		 * @param candidates Candidate wrappers of mutation
+		 */
+		PCKGeneticAlgorithm(const library::GAParameters &gaParams, std::shared_ptr<WrapperArray> candidates)
+			: super(false, gaParams)
+		{
+			this->candidates = candidates;
+		};
+
 	protected:
 		/**
 		 * @brief Cause a mutation on a sequence list.
@@ -56,19 +70,58 @@ namespace packer
 		 *	\li http://samchon.github.io/framework/api/cpp/d5/d28/classsamchon_1_1library_1_1GeneticAlgorithm.html#ac5c1dcb9ca7ecd8980dca7aac2316ff0
 		 *	\li https://en.wikipedia.org/wiki/Mutation_(genetic_algorithm)
 		 *
+		 * <p> If the sequence list has a FeasibilityMatrix, a gene mutates only to Wrappers which can contain
+		 * the instance of the gene. </p>
+		 *
 		 * @param individual A sequcen list.
+		 * @param engine A random engine.
 		 */
-		virtual void mutate(std::shared_ptr<GAWrapperArray> individual) const override
+		virtual void mutate(std::shared_ptr<GAWrapperArray> individual, Engine &engine) const override
 		{
+			std::shared_ptr<FeasibilityMatrix> feasibility = individual->getFeasibility();
+
 			for (size_t i = 0; i < individual->size(); i++)
 			{
-				if (library::Math::random() > mutationRate)
+				if (random(engine) > mutationRate)
 					continue;
 
-				size_t index = (size_t)(library::Math::random() * candidates->size());
-				individual->at(i) = candidates->at(index);
+				if (feasibility != nullptr)
+				{
+					// DRAW ONLY WRAPPERS CAN CONTAIN THE INSTANCE
+					const std::vector<size_t> &feasibles = feasibility->getFeasibleWrappers(individual->getSKU(i));
+					if (feasibles.empty() == true)
+						continue;
+
+					size_t index = (size_t)(random(engine) * feasibles.size());
+					if (index == feasibles.size())
+						index--;
+
+					individual->at(i) = (uint16_t)feasibles[index];
+				}
+				else
+				{
+					size_t index = (size_t)(random(engine) * candidates->size());
+					if (index == candidates->size())
+						index--;
+
+					individual->at(i) = (uint16_t)index;
+				}
 			}
 		};
+
+		/**
+		 * @brief Evaluate a sequence list.
+		 *
+		 * @details Packs the sequence list on a worker thread and returns its fitness; price of the
+		 * sequence list, or infinity if it's not valid.
+		 *
+		 * @param individual A sequence list.
+		 * @return Fitness of the sequence list.
+		 */
+		virtual auto evaluate(std::shared_ptr<GAWrapperArray> individual) const -> double override
+		{
+			return individual->getFitness();
+		};
 	};
 };
 };
\ No newline at end of file
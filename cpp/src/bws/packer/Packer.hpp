@@ -7,13 +7,22 @@
 #include <bws/packer/GAWrapperArray.hpp>
 #include <bws/packer/WrapperGroup.hpp>
 #include <bws/packer/WrapperVolume.hpp>
+#include <bws/packer/FeasibilityMatrix.hpp>
+#include <bws/packer/FixedPoint.hpp>
+#include <bws/packer/IncumbentEvent.hpp>
+#include <bws/packer/CancelToken.hpp>
 
 #include <random>
+#include <chrono>
+#include <functional>
+#include <cmath>
+#include <stdexcept>
 #include <samchon/library/GAParameters.hpp>
 #include <samchon/library/GeneticAlgorithm.hpp>
 #include <samchon/library/Event.hpp>
 #include <samchon/library/ProgressEvent.hpp>
 #include <bws/packer/PCKGeneticAlgorithm.hpp>
+#include <bws/packer/PCKCountGeneticAlgorithm.hpp>
 
 namespace bws
 {
@@ -32,7 +41,9 @@ namespace packer
 	 * pack and executing Packer::optimize() method. </p>
 	 *
 	 * <p> During the optimization process by Packer::optimize(), ProgressEvent will be thrown. If you want
-	 * to listen the ProgressEvent, register a listener function by #addEventListener() method. </p>
+	 * to listen the ProgressEvent, register a listener function by #addEventListener() method; it's
+	 * delivered in background. To receive it synchronously, in order and before optimize() returns, set a
+	 * listener by #setProgressListener(). </p>
 	 *
 	 * <p> In background side, deducting packing solution, those algorithms are used. </p>
 	 * <ul>
@@ -53,7 +64,78 @@ namespace packer
 		typedef protocol::Entity<> super;
 		typedef library::EventDispatcher event_super;
 
+	public:
+		/**
+		 * @brief Statistics of an optimization.
+		 */
+		struct Statistics
+		{
+			/**
+			 * @brief Number of packings tried in repack(), including pruned ones.
+			 */
+			size_t repackTrials;
+
+			/**
+			 * @brief Number of packings skipped in repack() by lower bounds.
+			 */
+			size_t repackPrunings;
+		};
+
 	protected:
+		/**
+		 * @brief States of an optimization, a call of optimize().
+		 *
+		 * @details Packer is not modified by optimize(). States of an optimization are held by its own
+		 * Context and passed through the steps, so that a Packer can be optimized concurrently.
+		 */
+		struct Context
+		{
+			/**
+			 * @brief Wrappers to be packed; quantized ones by the #fixedPoint, if it exists.
+			 */
+			std::shared_ptr<WrapperArray> wrapperArray;
+
+			/**
+			 * @brief Instances to be packed; quantized ones by the #fixedPoint, if it exists.
+			 */
+			std::shared_ptr<InstanceArray> instanceArray;
+
+			/**
+			 * @brief Quantization of the Packer's Wrappers and Instances. nullptr if precision is zero.
+			 */
+			std::shared_ptr<FixedPoint> fixedPoint;
+
+			/**
+			 * @brief Feasibility of the #wrapperArray for the #instanceArray.
+			 */
+			std::shared_ptr<FeasibilityMatrix> feasibility;
+
+			/**
+			 * @brief The greedy solution, packed and re-packed by initGenes().
+			 */
+			std::shared_ptr<WrapperArray> greedy;
+
+			/**
+			 * @brief Token of the optimization. nullptr if not cancelable.
+			 */
+			std::shared_ptr<CancelToken> cancelToken;
+
+			/**
+			 * @brief The last IncumbentEvent delivered by the optimization.
+			 */
+			std::shared_ptr<IncumbentEvent> incumbent;
+
+			Statistics statistics;
+
+			/**
+			 * @brief Whether the #cancelToken is expired.
+			 */
+			auto isExpired() const -> bool
+			{
+				return cancelToken != nullptr && cancelToken->isExpired();
+			};
+		};
+
 		/**
 		 * @brief Type of Wrapper(s).
 		 */
@@ -64,6 +146,40 @@ namespace packer
 		 */
 		std::shared_ptr<InstanceArray> instanceArray;
 
+		/**
+		 * @brief Whether the genetic algorithm evolves count matrices, GACountArray.
+		 *
+		 * @details If false, sequence lists of GAWrapperArray are evolved.
+		 */
+		bool countGenes;
+
+		/**
+		 * @brief Precision of the geometry; length of a unit, in the caller's units.
+		 *
+		 * @details If not zero, optimize() packs in integer units of the precision.
+		 */
+		double precision;
+
+		/**
+		 * @brief Type of PackingEngine, packing each Wrapper.
+		 */
+		int engine;
+
+		/**
+		 * @brief Whether to deliver improved solutions during the optimization, by IncumbentEvent.
+		 */
+		bool anytime;
+
+		/**
+		 * @brief Listener of IncumbentEvent, in the anytime mode.
+		 */
+		std::function<void(std::shared_ptr<IncumbentEvent>)> incumbentListener;
+
+		/**
+		 * @brief Listener of ProgressEvent, called on the thread of optimize().
+		 */
+		std::function<void(std::shared_ptr<library::ProgressEvent>)> progressListener;
+
 	public:
 		/* -----------------------------------------------------------
 			CONSTRUCTORS
@@ -77,6 +193,11 @@ namespace packer
 		{
 			wrapperArray.reset(new WrapperArray());
 			instanceArray.reset(new InstanceArray());
+
+			countGenes = false;
+			precision = 0.0;
+			engine = PackingEngine::BOXOLOGIC;
+			anytime = false;
 		};
 
 		/**
@@ -92,6 +213,11 @@ namespace packer
 			this->wrapperArray = wrapperArray;
 			this->instanceArray = instanceArray;
 
+			countGenes = false;
+			precision = 0.0;
+			engine = PackingEngine::BOXOLOGIC;
+			anytime = false;
+
 			std::sort(wrapperArray->begin(), wrapperArray->end(), sortWrappers);
 		};
 		virtual ~Packer() = default;
@@ -101,6 +227,13 @@ namespace packer
 			wrapperArray->construct(xml->get(wrapperArray->TAG())->at(0));
 			instanceArray->construct(xml->get(instanceArray->TAG())->at(0));
 
+			if (xml->hasProperty("precision"))
+				setPrecision(xml->getProperty<double>("precision"));
+			if (xml->hasProperty("engine"))
+				engine = PackingEngine::toType(xml->getProperty("engine"));
+			if (xml->hasProperty("anytime"))
+				anytime = xml->getProperty<bool>("anytime");
+
 			std::sort(wrapperArray->begin(), wrapperArray->end(), sortWrappers);
 		};
 
@@ -124,6 +257,145 @@ namespace packer
 			return instanceArray;
 		};
 
+		/**
+		 * @brief Whether the genetic algorithm evolves count matrices.
+		 */
+		auto isCountGenes() const -> bool
+		{
+			return countGenes;
+		};
+
+		/**
+		 * @brief Get precision of the geometry.
+		 */
+		auto getPrecision() const -> double
+		{
+			return precision;
+		};
+
+		/**
+		 * @brief Get type of PackingEngine.
+		 */
+		auto getEngine() const -> int
+		{
+			return engine;
+		};
+
+		/**
+		 * @brief Whether improved solutions are delivered during the optimization.
+		 */
+		auto isAnytime() const -> bool
+		{
+			return anytime;
+		};
+
+		/* -----------------------------------------------------------
+			SETTERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Set whether the genetic algorithm evolves count matrices.
+		 *
+		 * @details
+		 * <p> Units of a SKU are interchangeable. A sequence list, GAWrapperArray, has a gene for each unit
+		 * so that most of its permutations deduct same groups. A count matrix, GACountArray, has numbers of
+		 * the units for each type of Wrapper instead; it's suitable for orders of large quantities. </p>
+		 *
+		 * @param val Whether to evolve count matrices. Default is false.
+		 */
+		void setCountGenes(bool val)
+		{
+			countGenes = val;
+		};
+
+		/**
+		 * @brief Set precision of the geometry.
+		 *
+		 * @details
+		 * <p> Dimensions of fractional values are not added up exactly in floating point. If a precision is
+		 * given, optimize() quantizes the Wrappers and Instances into integer units of the precision by
+		 * FixedPoint, packs them on exact values and returns the result in the caller's units. </p>
+		 *
+		 * <p> Quantization is conservative; dimensions of Instances are rounded up and those of Wrappers
+		 * are rounded down. </p>
+		 *
+		 * @param val Length of a unit, in the caller's units (e.g. 0.1 for 0.1 mm units of mm dimensions).
+		 *			  Zero (default) packs on the dimensions as they are.
+		 *
+		 * @throw invalid_argument The precision is negative or not finite.
+		 */
+		void setPrecision(double val)
+		{
+			if (!(val >= 0.0) || std::isinf(val))
+				throw std::invalid_argument("precision must be zero or a positive number.");
+
+			precision = val;
+		};
+
+		/**
+		 * @brief Set type of PackingEngine.
+		 *
+		 * @details
+		 * <p> PackingEngine::BOXOLOGIC searches layers of each Wrapper exhaustively; it's dense but its
+		 * execution time grows steeply by number of instances. PackingEngine::EXTREME_POINT places
+		 * instances on extreme points without searching layers; it's much faster, but less dense, on orders of a
+		 * large quantity. Its worst case is still quadratic in number of instances. </p>
+		 *
+		 * @param val Type of PackingEngine. Default is PackingEngine::BOXOLOGIC.
+		 */
+		void setEngine(int val)
+		{
+			engine = val;
+		};
+
+		/**
+		 * @brief Set whether to deliver improved solutions during the optimization.
+		 *
+		 * @details
+		 * <p> In the anytime mode, optimize() delivers an IncumbentEvent of the greedy solution, re-packed
+		 * to other types of Wrapper, as soon as it's constructed, before the genetic algorithm. Then, whenever
+		 * a generation finds a solution strictly cheaper than the last incumbent, an IncumbentEvent of the
+		 * solution is delivered. The result of optimize() is delivered, too, if it's cheaper than the last
+		 * incumbent. Incumbents are delivered to the listener set by #setIncumbentListener(). </p>
+		 *
+		 * <p> The optimization continues until the generations are evolved or the
+		 * {@link library::GAParameters::getTimeout timeout} expires; a listener can take the first incumbent
+		 * as a quick answer and replace it by following ones. </p>
+		 *
+		 * @param val Whether to deliver incumbents. Default is false.
+		 */
+		void setAnytime(bool val)
+		{
+			anytime = val;
+		};
+
+		/**
+		 * @brief Set listener of IncumbentEvent.
+		 *
+		 * @details The listener is called synchronously, on the thread of optimize(), so that incumbents
+		 * arrive in order and all of them before optimize() returns. A slow listener delays the
+		 * optimization.
+		 *
+		 * @param listener Listener of incumbents. An empty function to stop listening.
+		 */
+		void setIncumbentListener(std::function<void(std::shared_ptr<IncumbentEvent>)> listener)
+		{
+			incumbentListener = listener;
+		};
+
+		/**
+		 * @brief Set listener of ProgressEvent.
+		 *
+		 * @details Like #setIncumbentListener(), the listener is called synchronously on the thread of
+		 * optimize(), whenever a generation is evolved. Listeners registered by #addEventListener() are
+		 * still notified in background.
+		 *
+		 * @param listener Listener of progress. An empty function to stop listening.
+		 */
+		void setProgressListener(std::function<void(std::shared_ptr<library::ProgressEvent>)> listener)
+		{
+			progressListener = listener;
+		};
+
 		/* -----------------------------------------------------------
 			OPERATORS
 		----------------------------------------------------------- */
@@ -131,30 +403,63 @@ namespace packer
 		 * @brief Compute an optimized packing solution.
 		 *
 		 * @details
-		 * 
+		 * <p> If a <i>token</i> is given, the optimization can be stopped by {@link CancelToken::cancel
+		 * canceling} it from another thread or by its {@link CancelToken::getDeadline deadline}. Then the
+		 * optimization winds up at the next safe point and returns the best solution found until then; the
+		 * best of the last complete generation, or the greedy one if no generation is complete. Packings
+		 * after the expiration are done quickly and re-packing to other types of Wrapper is skipped, so that
+		 * the solution is complete but less optimized. </p>
 		 *
-		 * @param gaParams Parameters of genetic algorithm.
+		 * @param gaParams Parameters of genetic algorithm. Default is getDefaultGAParameters(); it evolves
+		 *				   the genetic algorithm, not only the greedy solution, for 10 seconds at most.
+		 * @param token Token to stop the optimization. nullptr if not cancelable.
+		 * @param statistics Statistics of the optimization, to be filled. nullptr if not needed.
 		 */
-		auto optimize(const library::GAParameters &gaParams = {500, 50, 20, .2}) const -> std::shared_ptr<WrapperArray>
+		auto optimize(const library::GAParameters &gaParams = getDefaultGAParameters(), std::shared_ptr<CancelToken> token = nullptr, Statistics *statistics = nullptr) const -> std::shared_ptr<WrapperArray>
 		{
 			// TO BE RETURNED
 			std::shared_ptr<WrapperArray> wrappers(new WrapperArray());
 
-			if (wrapperArray->size() == 1)
+			// STATES OF THIS OPTIMIZATION
+			Context context;
+			context.cancelToken = token;
+			context.statistics = { 0, 0 };
+
+			// QUANTIZE THE GEOMETRY, IF A PRECISION IS GIVEN
+			if (precision != 0.0)
+			{
+				context.fixedPoint.reset(new FixedPoint(precision, this->wrapperArray, this->instanceArray));
+				context.wrapperArray = context.fixedPoint->getWrapperArray();
+				context.instanceArray = context.fixedPoint->getInstanceArray();
+			}
+			else
+			{
+				context.wrapperArray = this->wrapperArray;
+				context.instanceArray = this->instanceArray;
+			}
+			context.feasibility.reset(new FeasibilityMatrix(context.wrapperArray, context.instanceArray));
+
+			// WHETHER ALL INSTANCES CAN BE PACKED
+			bool feasible = true;
+
+			if (context.wrapperArray->size() == 1)
 			{
 				// ONLY A TYPE OF WRAPPER EXISTS,
 				// OPTMIZE IN LEVEL OF WRAPPER_GROUP AND TERMINATE THE OPTIMIZATION
-				std::shared_ptr<WrapperGroup> wrapperGroup(new WrapperGroup(wrapperArray->front()));
+				std::shared_ptr<WrapperGroup> wrapperGroup(new WrapperGroup(context.wrapperArray->front()));
+				wrapperGroup->setEngine(engine);
 
 				// IF THERE'S AN INSTANCE CANNOT BE PACKED BY SIZE 
 				// (AN INSTANCE IS GREATER THAN THE WRAPPER)
-				for (size_t i = 0; i < instanceArray->size(); i++)
-					if (wrapperGroup->allocate(instanceArray->at(i)) == false)
-						return wrappers;
+				for (size_t i = 0; i < context.instanceArray->size() && feasible == true; i++)
+					feasible = wrapperGroup->allocate(context.instanceArray->at(i));
 
 				// FETCH THE OPTIMIZATION RESULT
-				wrapperGroup->optimize();
-				wrappers->assign(wrapperGroup->begin(), wrapperGroup->end());
+				if (feasible == true)
+				{
+					wrapperGroup->optimize(context.cancelToken.get());
+					wrappers->assign(wrapperGroup->begin(), wrapperGroup->end());
+				}
 			}
 			else
 			{
@@ -162,52 +467,51 @@ namespace packer
 				// WITH GENETIC_ALGORITHM
 				////////////////////////////////////////
 				// CONSTRUCT INITIAL SET
-				std::shared_ptr<GAWrapperArray> geneArray = initGenes();
-				//shared_ptr<GAPopulation<GAWrapperArray>> population(new GAPopulation<GAWrapperArray>(geneArray, gaParams.getPopulation()));
-
-				//// EVOLVE
-				//PCKGeneticAlgorithm geneticAlgorithm
-				//(
-				//	gaParams.getMutationRate(), 
-				//	gaParams.getTournament(),
-				//	wrapperArray // CANDIDATES
-				//);
-
-				//size_t generation = gaParams.getGeneration();
-				//for (size_t i = 0; i < generation; i++)
-				//{
-				//	population = geneticAlgorithm.evolvePopulation(population);
+				std::shared_ptr<GAWrapperArray> geneArray = initGenes(context);
 
-				//	shared_ptr<Event> event(new ProgressEvent(nullptr, i + 1, generation));
-				//	((Packer*)this)->dispatch(event);
-				//}
+				// THE GREEDY SOLUTION, AS THE FIRST INCUMBENT; LATER ONES ONLY IF STRICTLY CHEAPER
+				if (anytime == true)
+					publish(context, context.greedy);
 
-				//geneArray = population->fitTest();
+				// EVOLVE AND FETCH RESULT
+				std::unordered_map<std::string, std::shared_ptr<WrapperGroup>> result;
+				if (countGenes == true)
+					result = evolveCounts(context, std::make_shared<GACountArray>(*geneArray), gaParams)->getResult();
+				else
+					result = evolveGenes(context, geneArray, gaParams)->getResult();
 
-				// FETCH RESULT AND
-				auto &result = geneArray->getResult();
-				for (auto it = result.begin(); it != result.end(); it++)
-					wrappers->insert(wrappers->end(), it->second->begin(), it->second->end());
+				wrappers = flatten(result);
 
 				// DO THE POST-PROCESS
-				wrappers = repack(wrappers);
+				wrappers = repack(context, wrappers);
 			}
 
-			// SORT THE WRAPPERS BY ITEMS' POSITION
-			for (size_t i = 0; i < wrappers->size(); i++)
-				sort(wrappers->at(i)->begin(), wrappers->at(i)->end(),
-					[](const std::shared_ptr<Wrap> &left, const std::shared_ptr<Wrap> &right) -> bool
-					{
-						if (left->getZ() != right->getZ())
-							return left->getZ() < right->getZ();
-						else if (left->getY() != right->getY())
-							return left->getY() < right->getY();
-						else
-							return left->getX() < right->getX();
-					});
+			if (statistics != nullptr)
+				*statistics = context.statistics;
+
+			// AN INSTANCE IS GREATER THAN THE WRAPPER; NO SOLUTION
+			if (feasible == false)
+				return wrappers;
+
+			if (anytime == true)
+				publish(context, wrappers);
 
 			// RETURN WRAPPERS HAVE PACKED.
-			return wrappers;
+			return complete(context, wrappers);
+		};
+
+		/**
+		 * @brief Get default parameters of genetic algorithm.
+		 *
+		 * @details 500 generations of 50 individuals, tournaments of 20 and mutation rate 0.2, within a
+		 * {@link library::GAParameters::getTimeout timeout} of 10 seconds.
+		 */
+		static auto getDefaultGAParameters() -> library::GAParameters
+		{
+			library::GAParameters gaParams(500, 50, 20, .2);
+			gaParams.setTimeout(10000);
+
+			return gaParams;
 		};
 
 	protected:
@@ -234,12 +538,17 @@ namespace packer
 		 * to another type of Wrapper, deducts the best solution between them. It's the initial sequence list
 		 * of genetic algorithm. </p>
 		 *
+		 * @param context States of the optimization.
 		 * @return Initial sequence list.
 		 */
-		virtual auto initGenes() const -> std::shared_ptr<GAWrapperArray>
+		virtual auto initGenes(Context &context) const -> std::shared_ptr<GAWrapperArray>
 		{
 			using namespace std;
 
+			shared_ptr<WrapperArray> wrapperArray = context.wrapperArray;
+			shared_ptr<InstanceArray> instanceArray = context.instanceArray;
+			shared_ptr<FeasibilityMatrix> feasibility = context.feasibility;
+
 			////////////////////////////////////////////////////
 			// LINEAR OPTIMIZATION
 			////////////////////////////////////////////////////
@@ -251,6 +560,7 @@ namespace packer
 				const shared_ptr<Wrapper> &wrapper = wrapperArray->at(i);
 
 				wrapperGroups.emplace_back(new WrapperGroup(wrapper));
+				wrapperGroups.back()->setEngine(engine);
 			}
 
 			// CONSTRUCT VOLUMES
@@ -264,15 +574,15 @@ namespace packer
 			for (size_t i = 0; i < instanceArray->size(); i++)
 			{
 				shared_ptr<Instance> instance = instanceArray->at(i);
+				size_t instanceIndex = feasibility->indexOf(*instance);
 				double minProprity = INT_MAX;
 				size_t minIndex = 0;
 		
 				for (size_t j = 0; j < wrapperVolumes.size(); j++)
 				{
-					const auto &wrapper = wrapperArray->at(j);
 					auto &volume = wrapperVolumes.at(j);
 
-					if (wrapper->operator>=(*instance) == false)
+					if (feasibility->feasible(j, instanceIndex) == false)
 						continue;
 
 					double priority = volume.getPriority(instance);
@@ -292,7 +602,8 @@ namespace packer
 					volume.allocate(instance);
 				}
 
-				wrapperGroup->allocate(instance, 1);
+				if (feasibility->feasible(minIndex, instanceIndex) == true)
+					wrapperGroup->allocateFeasible(feasibility->getInstanceTable(), instanceIndex, 1);
 			}
 
 
@@ -302,93 +613,254 @@ namespace packer
 			// OPTIMIZE WRAPPER_GROUP
 			shared_ptr<WrapperArray> wrappers(new WrapperArray());
 
+			// GROUPS ARE INDEPENDENT; OPTIMIZE THEM IN PARALLEL
+			#pragma omp parallel for schedule(dynamic)
+			for (int i = 0; i < (int)wrapperGroups.size(); i++)
+				wrapperGroups[i]->optimize(context.cancelToken.get());
+
+			// ASSIGN THE GROUP'S, IN ORDER
 			for (size_t i = 0; i < wrapperGroups.size(); i++)
 			{
-				// OPTIMIZE AND ASSIGN THE GROUP'S
 				shared_ptr<WrapperGroup> &wrapperGroup = wrapperGroups.at(i);
-
-				wrapperGroup->optimize();
 				wrappers->insert(wrappers->end(), wrapperGroup->begin(), wrapperGroup->end());
 			}
 
 			// DO EARLY POST-PROCESS
-			wrappers = repack(wrappers);
+			wrappers = repack(context, wrappers);
+			context.greedy = wrappers;
 
 			////////////////////////////////////////////////////
 			// CONSTRUCT GENE_ARRAY
 			////////////////////////////////////////////////////
 			// INSTANCES AND GENES
 			shared_ptr<InstanceArray> ga_instances(new InstanceArray());
-			shared_ptr<WrapperArray> genes(new WrapperArray());
+			vector<uint16_t> genes;
 
 			for (size_t i = 0; i < wrappers->size(); i++)
 			{
 				auto &wrapper = wrappers->at(i);
 
+				// GENES ARE INDICES OF THE TYPES OF WRAPPER, THOSE IN THE FEASIBILITY
+				uint16_t type = (uint16_t)feasibility->indexOf(*wrapper);
+
 				for (size_t j = 0; j < wrapper->size(); j++)
 				{
 					ga_instances->push_back(wrapper->at(j)->getInstance());
-					genes->push_back(wrapper);
+					genes.push_back(type);
 				}
 			}
 
 			// GENE_ARRAY
-			shared_ptr<GAWrapperArray> geneArray(new GAWrapperArray(ga_instances));
-			geneArray->assign(genes->begin(), genes->end());
+			shared_ptr<GAWrapperArray> geneArray(new GAWrapperArray(ga_instances, feasibility));
+			geneArray->assign(genes.begin(), genes.end());
+			geneArray->setEngine(engine);
+			geneArray->setCancelToken(context.cancelToken.get());
 
 			return geneArray;
 		};
 
+		/**
+		 * @brief Evolve the sequence list by genetic algorithm.
+		 *
+		 * @details
+		 * <p> Evolves a population derived from the initial sequence list, during the generations or until
+		 * the {@link library::GAParameters::getTimeout timeout}. Packing processes of a generation are
+		 * done in parallel, by {@link library::GAParameters::getThreads threads}. When the population is
+		 * divided into {@link library::GAParameters::getIslands islands}, the islands evolve in parallel
+		 * and exchange their elites periodically. </p>
+		 *
+		 * <p> A ProgressEvent is dispatched whenever a generation is evolved. When the timeout expires, 
+		 * the best sequence list found until then is returned. When the {@link Context::cancelToken token}
+		 * is expired, a generation not completed is discarded and the best of the last complete one is
+		 * returned. </p>
+		 *
+		 * @param context States of the optimization.
+		 * @param geneArray Initial sequence list.
+		 * @param gaParams Parameters of genetic algorithm.
+		 *
+		 * @return The best sequence list.
+		 */
+		virtual auto evolveGenes(Context &context, std::shared_ptr<GAWrapperArray> geneArray, const library::GAParameters &gaParams) const -> std::shared_ptr<GAWrapperArray>
+		{
+			PCKGeneticAlgorithm geneticAlgorithm(gaParams, context.wrapperArray);
+
+			return evolve(context, geneticAlgorithm, geneArray, gaParams);
+		};
+
+		/**
+		 * @brief Evolve the count matrix by genetic algorithm.
+		 *
+		 * @details Same with evolveGenes(), but evolves count matrices by PCKCountGeneticAlgorithm.
+		 *
+		 * @param context States of the optimization.
+		 * @param countArray Initial count matrix.
+		 * @param gaParams Parameters of genetic algorithm.
+		 *
+		 * @return The best count matrix.
+		 */
+		virtual auto evolveCounts(Context &context, std::shared_ptr<GACountArray> countArray, const library::GAParameters &gaParams) const -> std::shared_ptr<GACountArray>
+		{
+			PCKCountGeneticAlgorithm geneticAlgorithm(gaParams);
+
+			return evolve(context, geneticAlgorithm, countArray, gaParams);
+		};
+
+	private:
+		/**
+		 * @brief Evolve an individual by a genetic algorithm, during the generations or until the timeout.
+		 */
+		template <class GeneticAlgorithm, class GeneArray>
+		auto evolve(Context &context, const GeneticAlgorithm &geneticAlgorithm, std::shared_ptr<GeneArray> geneArray, const library::GAParameters &gaParams) const -> std::shared_ptr<GeneArray>
+		{
+			using namespace std;
+
+			size_t generation = gaParams.getGeneration();
+			if (generation == 0 || gaParams.getPopulation() <= 1)
+				return geneArray;
+
+			chrono::steady_clock::time_point deadline = chrono::steady_clock::now() + chrono::milliseconds(gaParams.getTimeout());
+
+			vector<shared_ptr<typename GeneticAlgorithm::Population>> islands = geneticAlgorithm.createIslands(geneArray, gaParams.getPopulation());
+			bool evolved = false;
+
+			for (size_t i = 0; i < generation && context.isExpired() == false; i++)
+			{
+				vector<shared_ptr<typename GeneticAlgorithm::Population>> offspring = geneticAlgorithm.evolveIslands(islands);
+
+				// INTERRUPTED BY THE CANCEL TOKEN; KEEP THE LAST COMPLETE GENERATION
+				if (context.isExpired() == true)
+					break;
+
+				islands = move(offspring);
+				evolved = true;
+
+				// A STRICTLY CHEAPER SOLUTION, AS A NEW INCUMBENT
+				if (anytime == true)
+				{
+					shared_ptr<GeneArray> best = geneticAlgorithm.fitTest(islands);
+					if (context.incumbent == nullptr || best->getFitness() < context.incumbent->getPrice())
+						publish(context, flatten(best->getResult()));
+				}
+
+				shared_ptr<library::ProgressEvent> event(new library::ProgressEvent((Packer*)this, i + 1, generation));
+				if (progressListener)
+					progressListener(event);
+				((Packer*)this)->dispatch(event);
+
+				if (gaParams.getTimeout() != 0 && chrono::steady_clock::now() >= deadline)
+					break;
+			}
+
+			if (evolved == false)
+				return geneArray;
+			else
+				return geneticAlgorithm.fitTest(islands);
+		};
+
+	protected:
 		/**
 		 * @brief Try to repack each wrappers to another type.
 		 *
 		 * @details Re-packs instances who are packed in the $wrappers to another type of Wrappers. 
 		 *			A type of Wrapper with the smallest cost will be returned, containing the instances.
 		 *
+		 *			Each pair of a wrapper and another type is an independent packing, thus they're packed in
+		 *			parallel. The smallest cost is chosen in order of the types, so that the result is same with
+		 *			packing them sequentially.
+		 *
+		 *			A pair is not packed when {@link WrapperGroup::getLowerBound lower bound} of its cost is not
+		 *			less than the wrapper's price; it cannot be chosen. Numbers of the tried and skipped
+		 *			packings are counted in {@link Context::statistics statistics} of the optimization.
+		 *
+		 *			After the {@link Context::cancelToken token} is expired, pairs not packed yet are
+		 *			skipped; the wrappers are kept as they are.
+		 *
+		 * @param context States of the optimization.
 		 * @param $wrappers Wrappers to repack.
 		 * @return Re-packed wrappers.
 		 */
-		virtual auto repack(const std::shared_ptr<WrapperArray> $wrappers) const -> std::shared_ptr<WrapperArray>
+		virtual auto repack(Context &context, const std::shared_ptr<WrapperArray> $wrappers) const -> std::shared_ptr<WrapperArray>
 		{
 			using namespace std;
 
-			shared_ptr<WrapperArray> result(new WrapperArray());
+			shared_ptr<WrapperArray> wrapperArray = context.wrapperArray;
+			shared_ptr<FeasibilityMatrix> feasibility = context.feasibility;
+			size_t types = wrapperArray->size();
 
-			for (size_t i = 0; i < $wrappers->size(); i++)
+			// GROUPS OF EACH PAIR; (WRAPPER, TYPE)
+			vector<shared_ptr<WrapperGroup>> groups($wrappers->size() * types, nullptr);
+
+			size_t trials = 0;
+			size_t prunings = 0;
+
+			#pragma omp parallel for schedule(dynamic) reduction(+:trials, prunings)
+			for (int index = 0; index < (int)groups.size(); index++)
 			{
-				shared_ptr<Wrapper> wrapper = $wrappers->at(i);
-				shared_ptr<WrapperGroup> minGroup(new WrapperGroup(wrapper));
+				shared_ptr<Wrapper> wrapper = $wrappers->at(index / types);
+				shared_ptr<Wrapper> myWrapper = wrapperArray->at(index % types);
 
-				minGroup->push_back(wrapper);
+				if (wrapper->operator==(*myWrapper) || context.isExpired() == true)
+					continue;
 
-				for (size_t j = 0; j < this->wrapperArray->size(); j++)
+				// Ÿ Ÿ Wrapper  Group 
+				shared_ptr<WrapperGroup> myGroup(new WrapperGroup(myWrapper));
+				myGroup->setEngine(engine);
+				for (size_t k = 0; k < wrapper->size(); k++)
 				{
-					shared_ptr<Wrapper> myWrapper = this->wrapperArray->at(j);
+					shared_ptr<Instance> instance = wrapper->at(k)->getInstance();
+					size_t instanceIndex = feasibility->indexOf(*instance);
 
-					if (wrapper->operator==(*myWrapper))
-						continue;
+					bool feasible = (instanceIndex == (size_t)-1)
+						? myWrapper->operator>=(*instance)
+						: feasibility->feasible(index % types, instanceIndex);
+					if (feasible == false)
+					{
+						// ʹ Ŀ Է   ǰ 
+						myGroup = nullptr;
+						break;
+					}
+					if (instanceIndex == (size_t)-1)
+						myGroup->allocateFeasible(instance, 1);
+					else
+						myGroup->allocateFeasible(feasibility->getInstanceTable(), instanceIndex, 1);
+				}
 
-					bool valid = true;
+				// 
+				if (myGroup == nullptr)
+					continue;
 
-					// Ÿ Ÿ Wrapper  Group 
-					shared_ptr<WrapperGroup> myGroup(new WrapperGroup(myWrapper));
-					for (size_t k = 0; k < wrapper->size(); k++)
-						if (myGroup->allocate(wrapper->at(k)->getInstance(), 1) == false)
-						{
-							// ʹ Ŀ Է   ǰ 
-							valid = false;
-							break;
-						}
+				// CANNOT BE CHEAPER THAN THE WRAPPER, EVEN BY THE LOWER BOUND
+				trials++;
+				if (myGroup->getLowerBound() * myWrapper->getPrice() >= wrapper->getPrice())
+				{
+					prunings++;
+					continue;
+				}
 
-					// 
-					if (valid == false)
-						continue;
+				// ׷  ȭ ǽ
+				myGroup->optimize(context.cancelToken.get());
+				groups[index] = myGroup;
+			}
+
+			context.statistics.repackTrials += trials;
+			context.statistics.repackPrunings += prunings;
+
+			// REDUCE IN ORDER
+			shared_ptr<WrapperArray> result(new WrapperArray());
+
+			for (size_t i = 0; i < $wrappers->size(); i++)
+			{
+				shared_ptr<Wrapper> wrapper = $wrappers->at(i);
+				shared_ptr<WrapperGroup> minGroup(new WrapperGroup(wrapper));
 
-					// ׷  ȭ ǽ
-					myGroup->optimize();
+				minGroup->push_back(wrapper);
+
+				for (size_t j = 0; j < types; j++)
+				{
+					shared_ptr<WrapperGroup> &myGroup = groups[i * types + j];
 
 					//  ׷  δٸ, ü
-					if (myGroup->getPrice() < minGroup->getPrice())
+					if (myGroup != nullptr && myGroup->getPrice() < minGroup->getPrice())
 						minGroup = myGroup;
 				}
 
@@ -399,6 +871,84 @@ namespace packer
 		};
 
 	private:
+		/**
+		 * @brief Complete packed Wrappers as a solution.
+		 *
+		 * @details Decodes the Wrappers to the caller's units if they're quantized, and sorts wraps of each
+		 *			Wrapper by their positions.
+		 *
+		 * @param context States of the optimization.
+		 * @param wrappers Packed Wrappers.
+		 * @return The solution.
+		 */
+		auto complete(const Context &context, std::shared_ptr<WrapperArray> wrappers) const -> std::shared_ptr<WrapperArray>
+		{
+			// BACK TO THE CALLER'S UNITS
+			if (context.fixedPoint != nullptr)
+				wrappers = context.fixedPoint->decode(wrappers);
+
+			// SORT THE WRAPPERS BY ITEMS' POSITION
+			for (size_t i = 0; i < wrappers->size(); i++)
+				sort(wrappers->at(i)->begin(), wrappers->at(i)->end(),
+					[](const std::shared_ptr<Wrap> &left, const std::shared_ptr<Wrap> &right) -> bool
+					{
+						if (left->getZ() != right->getZ())
+							return left->getZ() < right->getZ();
+						else if (left->getY() != right->getY())
+							return left->getY() < right->getY();
+						else
+							return left->getX() < right->getX();
+					});
+
+			return wrappers;
+		};
+
+		/**
+		 * @brief Deliver packed Wrappers as a new incumbent, if they're strictly cheaper than the last one.
+		 *
+		 * @details The Wrappers are shared with the optimization, which continues after the delivery. Thus
+		 *			copies of them, sharing the Wrap objects, are completed and delivered to the
+		 *			#incumbentListener, on this thread.
+		 *
+		 * @param context States of the optimization.
+		 * @param wrappers Packed Wrappers.
+		 */
+		void publish(Context &context, std::shared_ptr<WrapperArray> wrappers) const
+		{
+			if (context.incumbent != nullptr && wrappers->getPrice() >= context.incumbent->getPrice())
+				return;
+
+			std::shared_ptr<WrapperArray> solution(new WrapperArray());
+			solution->reserve(wrappers->size());
+
+			for (size_t i = 0; i < wrappers->size(); i++)
+			{
+				// COPY CONSTRUCTOR OF WRAPPER DOESN'T COPY WRAPS
+				const std::shared_ptr<Wrapper> &wrapper = wrappers->at(i);
+				std::shared_ptr<Wrapper> copy(new Wrapper(*wrapper));
+
+				copy->assign(wrapper->begin(), wrapper->end());
+				solution->push_back(copy);
+			}
+
+			context.incumbent.reset(new IncumbentEvent((Packer*)this, complete(context, solution), context.incumbent.get()));
+			if (incumbentListener)
+				incumbentListener(context.incumbent);
+		};
+
+		/**
+		 * @brief Get Wrappers of groups.
+		 */
+		static auto flatten(const std::unordered_map<std::string, std::shared_ptr<WrapperGroup>> &result) -> std::shared_ptr<WrapperArray>
+		{
+			std::shared_ptr<WrapperArray> wrappers(new WrapperArray());
+
+			for (auto it = result.begin(); it != result.end(); it++)
+				wrappers->insert(wrappers->end(), it->second->begin(), it->second->end());
+
+			return wrappers;
+		};
+
 		static auto sortWrappers(const std::shared_ptr<Wrapper> &left, const std::shared_ptr<Wrapper> &right) -> bool
 		{
 			return left->getVolume() > right->getVolume();
@@ -419,6 +969,13 @@ namespace packer
 			xml->push_back(wrapperArray->toXML());
 			xml->push_back(instanceArray->toXML());
 
+			if (precision != 0.0)
+				xml->setProperty("precision", precision);
+			if (engine != PackingEngine::BOXOLOGIC)
+				xml->setProperty("engine", PackingEngine::toName(engine));
+			if (anytime == true)
+				xml->setProperty("anytime", anytime);
+
 			return xml;
 		};
 	};
@@ -6,6 +6,7 @@
 #include <bws/packer/InstanceFormArray.hpp>
 #include <bws/packer/WrapperArray.hpp>
 #include <bws/packer/Packer.hpp>
+#include <bws/packer/CancelToken.hpp>
 
 #include <samchon/library/GAParameters.hpp>
 
@@ -16,6 +17,11 @@ namespace packer
 	/**
 	 * @brief Bridge of Packer for repeated instances.
 	 *
+	 * @details
+	 * <p> A request without <i>gaParameters</i> is optimized by Packer::getDefaultGAParameters(). If the
+	 * <i>gaParameters</i> have no <i>timeout</i>, the timeout of the default ones is applied; the genetic
+	 * algorithm of a request is always bounded in time. </p>
+	 *
 	 * @author Jeongho Nam <http://samchon.org>
 	 */
 	class PackerForm
@@ -28,6 +34,26 @@ namespace packer
 		std::shared_ptr<WrapperArray> wrapperArray;
 		std::shared_ptr<library::GAParameters> gaParameters;
 
+		/**
+		 * @brief Precision of the geometry, zero if not quantized.
+		 */
+		double precision;
+
+		/**
+		 * @brief Type of PackingEngine.
+		 */
+		int engine;
+
+		/**
+		 * @brief Whether to deliver improved solutions during the optimization.
+		 */
+		bool anytime;
+
+		/**
+		 * @brief Time budget of the request in milliseconds, zero if unlimited.
+		 */
+		size_t budget;
+
 	public:
 		/* -----------------------------------------------------------
 			CONSTRUCTORS
@@ -40,7 +66,12 @@ namespace packer
 		{
 			instanceFormArray.reset(new InstanceFormArray());
 			wrapperArray.reset(new WrapperArray());
-			gaParameters.reset(new library::GAParameters());
+			gaParameters.reset(new library::GAParameters(Packer::getDefaultGAParameters()));
+
+			precision = 0.0;
+			engine = PackingEngine::BOXOLOGIC;
+			anytime = false;
+			budget = 0;
 		};
 		virtual ~PackerForm() = default;
 
@@ -49,10 +80,36 @@ namespace packer
 			instanceFormArray->construct(xml->get(instanceFormArray->TAG())->at(0));
 			wrapperArray->construct(xml->get(wrapperArray->TAG())->at(0));
 
+			// PARAMETERS OF GENETIC ALGORITHM, BOUNDED BY THE DEFAULT TIMEOUT IF NOT SPECIFIED
+			gaParameters.reset(new library::GAParameters(Packer::getDefaultGAParameters()));
 			if (xml->has(gaParameters->TAG()))
-				gaParameters->construct(xml->get(gaParameters->TAG())->at(0));
+			{
+				std::shared_ptr<library::XML> gaXML = xml->get(gaParameters->TAG())->at(0);
+
+				gaParameters->construct(gaXML);
+				if (gaXML->hasProperty("timeout") == false)
+					gaParameters->setTimeout(Packer::getDefaultGAParameters().getTimeout());
+			}
+
+			if (xml->hasProperty("precision"))
+				precision = xml->getProperty<double>("precision");
+			else
+				precision = 0.0;
+
+			if (xml->hasProperty("engine"))
+				engine = PackingEngine::toType(xml->getProperty("engine"));
+			else
+				engine = PackingEngine::BOXOLOGIC;
+
+			if (xml->hasProperty("anytime"))
+				anytime = xml->getProperty<bool>("anytime");
+			else
+				anytime = false;
+
+			if (xml->hasProperty("budget"))
+				budget = xml->getProperty<size_t>("budget");
 			else
-				gaParameters.reset(new library::GAParameters());
+				budget = 0;
 		};
 
 		/* -----------------------------------------------------------
@@ -60,9 +117,10 @@ namespace packer
 		----------------------------------------------------------- */
 		auto optimize() const -> std::shared_ptr<WrapperArray>
 		{
-			auto &packer = this->toPacker();
+			auto token = this->toCancelToken();
+			auto packer = this->toPacker();
 
-			return packer->optimize(*gaParameters);
+			return packer->optimize(*gaParameters, token);
 		};
 
 		/**
@@ -73,6 +131,56 @@ namespace packer
 			return gaParameters;
 		};
 
+		/**
+		 * @brief Get precision of the geometry.
+		 *
+		 * @details Length of a unit, in the caller's units. Dimensions are quantized into integer units of
+		 * the precision during the packing, and the result is emitted in the caller's units.
+		 *
+		 * @see Packer::setPrecision()
+		 */
+		auto getPrecision() const -> double
+		{
+			return precision;
+		};
+
+		/**
+		 * @brief Get type of PackingEngine.
+		 *
+		 * @details Given by the <i>engine</i> property; "boxologic" (default) or "extremePoint".
+		 *
+		 * @see Packer::setEngine()
+		 */
+		auto getEngine() const -> int
+		{
+			return engine;
+		};
+
+		/**
+		 * @brief Whether improved solutions are delivered during the optimization.
+		 *
+		 * @see Packer::setAnytime()
+		 */
+		auto isAnytime() const -> bool
+		{
+			return anytime;
+		};
+
+		/**
+		 * @brief Get time budget of the request.
+		 *
+		 * @details Given by the <i>budget</i> property, in milliseconds; zero (default) if unlimited. The
+		 * budget is counted from the admission of the request, so that time waiting in a queue is a part
+		 * of it. Unlike the {@link library::GAParameters::getTimeout timeout} of the genetic algorithm, it
+		 * bounds the whole optimization including re-packing.
+		 *
+		 * @see toCancelToken()
+		 */
+		auto getBudget() const -> size_t
+		{
+			return budget;
+		};
+
 		/* -----------------------------------------------------------
 			EXPORTERS
 		----------------------------------------------------------- */
@@ -88,12 +196,41 @@ namespace packer
 			xml->push_back(wrapperArray->toXML());
 			xml->push_back(gaParameters->toXML());
 
+			if (precision != 0.0)
+				xml->setProperty("precision", precision);
+			if (engine != PackingEngine::BOXOLOGIC)
+				xml->setProperty("engine", PackingEngine::toName(engine));
+			if (anytime == true)
+				xml->setProperty("anytime", anytime);
+			if (budget != 0)
+				xml->setProperty("budget", budget);
+
 			return xml;
 		};
 
 		virtual auto toPacker() const -> std::shared_ptr<Packer>
 		{
-			return std::make_shared<Packer>(wrapperArray, instanceFormArray->toInstanceArray());
+			std::shared_ptr<Packer> packer(new Packer(wrapperArray, instanceFormArray->toInstanceArray()));
+			packer->setPrecision(precision);
+			packer->setEngine(engine);
+			packer->setAnytime(anytime);
+
+			return packer;
+		};
+
+		/**
+		 * @brief Create a CancelToken of the request.
+		 *
+		 * @details The token expires when the #budget is spent, from now; call it at admission of the
+		 * request. Without a budget, the token has no deadline but can be canceled.
+		 */
+		auto toCancelToken() const -> std::shared_ptr<CancelToken>
+		{
+			std::shared_ptr<CancelToken> token(new CancelToken());
+			if (budget != 0)
+				token->setDeadline(std::chrono::steady_clock::now() + std::chrono::milliseconds(budget));
+
+			return token;
 		};
 	};
 };
@@ -0,0 +1,132 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <bws/packer/Wrapper.hpp>
+#include <bws/packer/InstanceArray.hpp>
+#include <bws/packer/InstanceTable.hpp>
+#include <bws/packer/CancelToken.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief An engine packing instances into a Wrapper.
+	 *
+	 * @details
+	 * <p> PackingEngine is an interface between WrapperGroup and algorithms of packing a single Wrapper. An
+	 * engine takes a Wrapper (its containable dimensions) and a list of instances, places as many instances
+	 * as possible into the Wrapper, and returns the placements as Wrap objects of the Wrapper and the
+	 * instances failed to be placed. </p>
+	 *
+	 * <p> Instances are given either by an InstanceArray or by SKU ids of an InstanceTable. </p>
+	 *
+	 * <p> An engine may keep buffers of a packing to be reused by the next one; an engine object must not be
+	 * shared by threads. </p>
+	 *
+	 * <p> An engine may check a CancelToken, set by #setCancelToken(), to wind up a packing quickly. Even if the
+	 * token is expired, the packing must be complete; only less dense. </p>
+	 *
+	 * <ul>
+	 *	<li> #BOXOLOGIC: boxologic::Boxologic, layer-by-layer search. </li>
+	 *	<li> #EXTREME_POINT: ExtremePoint, placement on extreme points. </li>
+	 * </ul>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class PackingEngine
+	{
+	protected:
+		/**
+		 * @brief Token of the optimization in progress. nullptr if not cancelable.
+		 */
+		const CancelToken *cancelToken;
+
+	public:
+		/**
+		 * @brief Types of engine.
+		 */
+		enum : int
+		{
+			BOXOLOGIC = 1,
+			EXTREME_POINT = 2
+		};
+
+		/**
+		 * @brief Default Constructor.
+		 */
+		PackingEngine()
+		{
+			cancelToken = nullptr;
+		};
+		virtual ~PackingEngine() = default;
+
+		/**
+		 * @brief Set token of the optimization in progress.
+		 *
+		 * @param token The token, or nullptr if not cancelable.
+		 */
+		void setCancelToken(const CancelToken *token)
+		{
+			cancelToken = token;
+		};
+
+		/**
+		 * @brief Pack instances to a Wrapper.
+		 *
+		 * @param wrapper A wrapper to pack instances.
+		 * @param instanceArray Instances trying to pack into the wrapper.
+		 *
+		 * @return A pair of the <i>wrapper</i> with packed instances and instances failed to pack by
+		 *		   overloading.
+		 */
+		virtual auto pack(std::shared_ptr<Wrapper> wrapper, std::shared_ptr<InstanceArray> instanceArray)
+			-> std::pair<std::shared_ptr<Wrapper>, std::shared_ptr<InstanceArray>> = 0;
+
+		/**
+		 * @brief Pack instances, given by their SKU ids, to a Wrapper.
+		 *
+		 * @param wrapper A wrapper to pack instances.
+		 * @param instanceTable Distinct instances.
+		 * @param skus SKU ids of instances trying to pack into the wrapper. After packing, SKU ids of
+		 *			   instances failed to pack by overloading.
+		 *
+		 * @return The <i>wrapper</i> with packed instances.
+		 */
+		virtual auto pack(std::shared_ptr<Wrapper> wrapper, std::shared_ptr<InstanceTable> instanceTable, std::vector<uint32_t> &skus)
+			-> std::shared_ptr<Wrapper> = 0;
+
+		/* -----------------------------------------------------------
+			TYPES
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get type of engine from its name.
+		 *
+		 * @param name Name of the engine; "boxologic" or "extremePoint".
+		 * @return Type of the engine. #BOXOLOGIC if the name is unknown.
+		 */
+		static auto toType(const std::string &name) -> int
+		{
+			if (name == "extremePoint")
+				return EXTREME_POINT;
+			else
+				return BOXOLOGIC;
+		};
+
+		/**
+		 * @brief Get name of a type of engine.
+		 */
+		static auto toName(int type) -> std::string
+		{
+			if (type == EXTREME_POINT)
+				return "extremePoint";
+			else
+				return "boxologic";
+		};
+	};
+};
+};
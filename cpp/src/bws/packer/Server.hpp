@@ -4,6 +4,7 @@
 #include <samchon/protocol/WebServer.hpp>
 
 #include <bws/packer/Client.hpp>
+#include <bws/packer/SolverPool.hpp>
 
 #include <iostream>
 
@@ -11,25 +12,59 @@ namespace bws
 {
 namespace packer
 {
+	/**
+	 * @brief Server of packing.
+	 *
+	 * @details
+	 * <p> Each connection is listened by its own thread, but packings are solved by a SolverPool shared by
+	 * all the connections. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
 	class Server 
 		: public protocol::WebServer
 	{
 	private:
 		typedef protocol::WebServer super;
 
+		/**
+		 * @brief Pool solving jobs of packing.
+		 *
+		 * @details Owned by the Server only. Clients refer it by raw pointers; a job holds its Client, so
+		 * that the last reference of a shared pool could be released on its own solver thread.
+		 */
+		std::unique_ptr<SolverPool> solverPool;
+
 	public:
-		Server()
+		/**
+		 * @brief Construct from numbers of solvers and limits of the job queue.
+		 *
+		 * @param solvers Number of solver threads. 0 means a quarter of the hardware threads, at least one.
+		 * @param capacity Maximum number of waiting jobs.
+		 * @param clientCapacity Maximum number of waiting jobs of a client.
+		 */
+		Server(size_t solvers = 0, size_t capacity = 64, size_t clientCapacity = 4)
 			: super()
 		{
+			solverPool.reset(new SolverPool(solvers, capacity, clientCapacity));
 		};
 		virtual ~Server() = default;
 
+		/**
+		 * @brief Get the pool solving jobs of packing.
+		 */
+		auto getSolverPool() const -> SolverPool*
+		{
+			return solverPool.get();
+		};
+
 	protected:
 		virtual void addClient(std::shared_ptr<protocol::ClientDriver> driver) override
 		{
-			std::cout << "A client has connected." << std::endl;
+			std::cout << "A client has connected. Jobs waiting: " << solverPool->getDepth() << std::endl;
 
-			std::unique_ptr<Client> client(new Client(driver));
+			std::shared_ptr<Client> client(new Client(driver, solverPool.get()));
+			client->listen();
 		};
 	};
 };
@@ -0,0 +1,324 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifdef _OPENMP
+#	include <omp.h>
+#endif
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief A bounded job queue with a fixed number of solver threads.
+	 *
+	 * @details
+	 * <p> SolverPool decouples reading sockets from solving. A socket thread only decodes a request and
+	 * pushes a job; a fixed number of solver threads pop and execute the jobs. Solves never run more than
+	 * the number of solvers at once, so that the CPU is not oversubscribed however many clients are
+	 * connected. </p>
+	 *
+	 * <p> Admission is controlled by two limits. A job is rejected if the queue is full, or if its owner
+	 * (a connection) already has as many jobs waiting as the limit per owner. Jobs are popped round-robin
+	 * between owners, so that a connection pushing many jobs cannot starve the others. </p>
+	 *
+	 * <p> Each solver limits OpenMP threads of its own parallel regions to a share of the hardware, so that
+	 * genetic algorithms of concurrent solves do not oversubscribe the CPU either. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class SolverPool
+	{
+	private:
+		/**
+		 * @brief Waiting jobs, by their owners.
+		 */
+		std::unordered_map<const void*, std::deque<std::function<void()>>> queues;
+
+		/**
+		 * @brief Owners having waiting jobs, in order of their turns.
+		 */
+		std::deque<const void*> turns;
+
+		std::vector<std::thread> solvers;
+		std::mutex mtx;
+		std::condition_variable cv;
+		bool closed;
+
+		size_t capacity;
+		size_t ownerCapacity;
+
+		/* -----------------------------------------------------------
+			METRICS
+		----------------------------------------------------------- */
+		size_t depth;
+		size_t peakDepth;
+		size_t active;
+
+		size_t accepted;
+		size_t rejected;
+		size_t completed;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Construct from numbers of solvers and limits of the queue.
+		 *
+		 * @param solvers Number of solver threads. 0 means a quarter of the hardware threads, at least one.
+		 * @param capacity Maximum number of waiting jobs.
+		 * @param ownerCapacity Maximum number of waiting jobs of an owner.
+		 */
+		SolverPool(size_t solvers = 0, size_t capacity = 64, size_t ownerCapacity = 4)
+		{
+			size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+			if (solvers == 0)
+				solvers = std::max<size_t>(hardware / 4, 1);
+
+			this->closed = false;
+			this->capacity = capacity;
+			this->ownerCapacity = ownerCapacity;
+
+			depth = peakDepth = active = 0;
+			accepted = rejected = completed = 0;
+
+			int threads = (int)std::max<size_t>(hardware / solvers, 1);
+			for (size_t i = 0; i < solvers; i++)
+				this->solvers.emplace_back(&SolverPool::solve, this, threads);
+		};
+
+		/**
+		 * @brief Destructor.
+		 *
+		 * @details Waiting jobs are discarded. Jobs being executed are waited until their completions.
+		 *			Thus a SolverPool must not be destroyed by its own job; a job must not own the pool.
+		 */
+		~SolverPool()
+		{
+			{
+				std::unique_lock<std::mutex> uk(mtx);
+
+				closed = true;
+				depth = 0;
+
+				queues.clear();
+				turns.clear();
+			}
+			cv.notify_all();
+
+			for (size_t i = 0; i < solvers.size(); i++)
+				solvers[i].join();
+		};
+
+		/* -----------------------------------------------------------
+			QUEUE
+		----------------------------------------------------------- */
+		/**
+		 * @brief Push a job.
+		 *
+		 * @param owner Owner of the job, a connection.
+		 * @param job The job.
+		 *
+		 * @return Whether the job is admitted. false if the queue or the owner's queue is full.
+		 */
+		auto push(const void *owner, std::function<void()> job) -> bool
+		{
+			{
+				std::unique_lock<std::mutex> uk(mtx);
+				std::deque<std::function<void()>> &queue = queues[owner];
+
+				if (closed == true || depth >= capacity || queue.size() >= ownerCapacity)
+				{
+					if (queue.empty() == true)
+						queues.erase(owner);
+
+					rejected++;
+					return false;
+				}
+
+				if (queue.empty() == true)
+					turns.push_back(owner);
+				queue.push_back(std::move(job));
+
+				accepted++;
+				peakDepth = std::max(++depth, peakDepth);
+			}
+			cv.notify_one();
+
+			return true;
+		};
+
+		/**
+		 * @brief Erase waiting jobs of an owner.
+		 *
+		 * @details Called when a connection is closed; its waiting jobs are no longer needed.
+		 *
+		 * @param owner Owner of the jobs.
+		 * @return Number of erased jobs.
+		 */
+		auto erase(const void *owner) -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+
+			auto it = queues.find(owner);
+			if (it == queues.end())
+				return 0;
+
+			size_t size = it->second.size();
+			depth -= size;
+
+			queues.erase(it);
+			turns.erase(std::find(turns.begin(), turns.end(), owner));
+
+			return size;
+		};
+
+	private:
+		/**
+		 * @brief Main loop of a solver thread.
+		 *
+		 * @param threads Maximum number of OpenMP threads of the solver.
+		 */
+		void solve(int threads)
+		{
+#ifdef _OPENMP
+			omp_set_num_threads(threads);
+#endif
+			while (true)
+			{
+				std::function<void()> job;
+				{
+					std::unique_lock<std::mutex> uk(mtx);
+					cv.wait(uk, [this]() -> bool
+					{
+						return closed == true || depth != 0;
+					});
+					if (closed == true)
+						return;
+
+					// POP FROM THE OWNER OF THIS TURN, AND PASS THE TURN
+					const void *owner = turns.front();
+					turns.pop_front();
+
+					std::deque<std::function<void()>> &queue = queues[owner];
+					job = std::move(queue.front());
+					queue.pop_front();
+
+					if (queue.empty() == true)
+						queues.erase(owner);
+					else
+						turns.push_back(owner);
+
+					depth--;
+					active++;
+				}
+
+				try
+				{
+					job();
+				}
+				catch (...)
+				{
+					// A FAILED JOB, LIKE SENDING TO A CLOSED CONNECTION, MUST NOT KILL THE SOLVER
+				}
+
+				std::unique_lock<std::mutex> uk(mtx);
+				active--;
+				completed++;
+			}
+		};
+
+	public:
+		/* -----------------------------------------------------------
+			GETTERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get number of solver threads.
+		 */
+		auto size() const -> size_t
+		{
+			return solvers.size();
+		};
+
+		/**
+		 * @brief Get maximum number of waiting jobs.
+		 */
+		auto getCapacity() const -> size_t
+		{
+			return capacity;
+		};
+
+		/**
+		 * @brief Get maximum number of waiting jobs of an owner.
+		 */
+		auto getOwnerCapacity() const -> size_t
+		{
+			return ownerCapacity;
+		};
+
+		/**
+		 * @brief Get number of waiting jobs.
+		 */
+		auto getDepth() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+			return depth;
+		};
+
+		/**
+		 * @brief Get the maximum number of waiting jobs ever reached.
+		 */
+		auto getPeakDepth() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+			return peakDepth;
+		};
+
+		/**
+		 * @brief Get number of jobs being executed.
+		 */
+		auto getActive() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+			return active;
+		};
+
+		/**
+		 * @brief Get number of admitted jobs.
+		 */
+		auto getAccepted() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+			return accepted;
+		};
+
+		/**
+		 * @brief Get number of rejected jobs.
+		 */
+		auto getRejected() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+			return rejected;
+		};
+
+		/**
+		 * @brief Get number of executed jobs.
+		 */
+		auto getCompleted() -> size_t
+		{
+			std::unique_lock<std::mutex> uk(mtx);
+			return completed;
+		};
+	};
+};
+};
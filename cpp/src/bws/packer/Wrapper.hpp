@@ -203,8 +203,8 @@ namespace packer
 			std::array<double, 3> wapperDims = { getContainableWidth(), getContainableHeight(), getContainableLength() };
 			std::array<double, 3> instanceDims = { instance.getWidth(), instance.getHeight(), instance.getLength() };
 
-			sort(wapperDims.begin(), wapperDims.end());
-			sort(instanceDims.begin(), instanceDims.end());
+			std::sort(wapperDims.begin(), wapperDims.end());
+			std::sort(instanceDims.begin(), instanceDims.end());
 
 			for (size_t i = 0; i < wapperDims.size(); i++)
 				if (wapperDims[i] < instanceDims[i])
@@ -4,9 +4,14 @@
 #include <bws/packer/WrapperArray.hpp>
 
 #include <bws/packer/InstanceArray.hpp>
+#include <bws/packer/InstanceTable.hpp>
 
 #include <array>
 #include <algorithm>
+#include <cmath>
+#include <bws/packer/PackingEngine.hpp>
+#include <bws/packer/CancelToken.hpp>
+#include <bws/packer/ExtremePoint.hpp>
 #include <boxologic/Boxologic.hpp>
 
 namespace bws
@@ -37,6 +42,30 @@ namespace packer
 		 */
 		std::shared_ptr<InstanceArray> allocatedInstanceArray;
 
+		/**
+		 * @brief Distinct instances, when instances are allocated by their SKU ids.
+		 *
+		 * @details nullptr if instances are allocated by objects; then they're in the #allocatedInstanceArray.
+		 */
+		std::shared_ptr<InstanceTable> instanceTable;
+
+		/**
+		 * @brief SKU ids of allocated instances, in the #instanceTable.
+		 */
+		std::vector<uint32_t> allocatedSKUs;
+
+		/**
+		 * @brief Type of the PackingEngine.
+		 */
+		int engine;
+
+		/**
+		 * @brief Token of the optimization in progress.
+		 *
+		 * @details Given by optimize() and valid only during it.
+		 */
+		const CancelToken *cancelToken;
+
 	public:
 		/* -----------------------------------------------------------
 			CONSTRUCTORS
@@ -48,6 +77,8 @@ namespace packer
 		{
 			sample = nullptr;
 			allocatedInstanceArray.reset(new InstanceArray());
+			engine = PackingEngine::BOXOLOGIC;
+			cancelToken = nullptr;
 		};
 
 		/** 
@@ -114,14 +145,33 @@ namespace packer
 			return sample;
 		};
 
+		/**
+		 * @brief Get type of the PackingEngine.
+		 */
+		auto getEngine() const -> int
+		{
+			return engine;
+		};
+
 		/**
 		 * @brief Get allocated instances.
 		 *
+		 * @details If instances are allocated by their SKU ids, a new InstanceArray is constructed.
+		 *
 		 * @return Allocated instances.
 		 */
 		auto getAllocatedInstanceArray() const -> std::shared_ptr<InstanceArray>
 		{
-			return allocatedInstanceArray;
+			if (instanceTable == nullptr)
+				return allocatedInstanceArray;
+
+			std::shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+			instanceArray->reserve(allocatedSKUs.size());
+
+			for (size_t i = 0; i < allocatedSKUs.size(); i++)
+				instanceArray->push_back(instanceTable->getInstance(allocatedSKUs[i]));
+
+			return instanceArray;
 		};
 
 		/**
@@ -146,6 +196,126 @@ namespace packer
 			return utilization / (double)size();
 		};
 
+		/**
+		 * @brief Get a lower bound of number of Wrappers.
+		 *
+		 * @details
+		 * <p> Computes a lower bound of number of Wrappers required to pack the allocated instances, without
+		 * packing them. The bound is the larger one between those. </p>
+		 *
+		 * <ul>
+		 *	<li> Volume bound: sum of instances' volume divided by containable volume of the sample. </li>
+		 *	<li> Large items bound, Martello-Pisinger-Vigo's L2 adapted to rotatable instances: a large 
+		 *		 instance is one of which the smallest dimension is greater than half of the sample's largest 
+		 *		 containable dimension. Two of them cannot be placed side by side on any axis, so that each of 
+		 *		 them requires its own Wrapper. Instances which cannot share a Wrapper with any large instance, 
+		 *		 in any orientations, require Wrappers of their own, too; their volume is bounded like above. 
+		 *	</li>
+		 * </ul>
+		 *
+		 * @return The lower bound. If the allocated instances are not empty, at least 1.
+		 */
+		auto getLowerBound() const -> size_t
+		{
+			if (sample == nullptr || (allocatedInstanceArray->empty() == true && allocatedSKUs.empty() == true))
+				return 0;
+
+			// SORTED DIMENSIONS OF THE INSTANCES
+			std::vector<std::array<double, 3>> dimensions;
+
+			if (instanceTable != nullptr)
+			{
+				dimensions.reserve(allocatedSKUs.size());
+				for (size_t i = 0; i < allocatedSKUs.size(); i++)
+				{
+					const InstanceTable::Record &record = instanceTable->at(allocatedSKUs[i]);
+					dimensions.push_back({ record.width, record.height, record.length });
+				}
+			}
+			else
+			{
+				dimensions.reserve(allocatedInstanceArray->size());
+				for (size_t i = 0; i < allocatedInstanceArray->size(); i++)
+				{
+					const std::shared_ptr<Instance> &instance = allocatedInstanceArray->at(i);
+					dimensions.push_back({ instance->getWidth(), instance->getHeight(), instance->getLength() });
+				}
+			}
+			for (size_t i = 0; i < dimensions.size(); i++)
+				std::sort(dimensions[i].begin(), dimensions[i].end());
+
+			// SAME DIMENSIONS ARE ADJACENT; TESTED BY TYPE
+			std::sort(dimensions.begin(), dimensions.end());
+
+			double maxDim = std::max
+			({
+				sample->getContainableWidth(),
+				sample->getContainableHeight(),
+				sample->getContainableLength()
+			});
+			
+			std::vector<std::array<double, 3>> largeTypes;
+			double volume = 0.0;
+			size_t larges = 0;
+
+			for (size_t i = 0; i < dimensions.size(); i++)
+			{
+				const std::array<double, 3> &dim = dimensions[i];
+
+				volume += dim[0] * dim[1] * dim[2];
+				if (dim[0] > maxDim / 2.0)
+				{
+					if (largeTypes.empty() == true || largeTypes.back() != dim)
+						largeTypes.push_back(dim);
+					larges++;
+				}
+			}
+
+			// VOLUME OF THE INSTANCES WHICH CANNOT SHARE A WRAPPER WITH ANY LARGE INSTANCE
+			double isolatedVolume = 0.0;
+
+			if (largeTypes.empty() == false)
+				for (size_t i = 0; i < dimensions.size(); )
+				{
+					const std::array<double, 3> &dim = dimensions[i];
+					size_t j = i + 1;
+
+					while (j < dimensions.size() && dimensions[j] == dim)
+						j++;
+
+					if (dim[0] <= maxDim / 2.0 && std::none_of
+						(
+							largeTypes.begin(), largeTypes.end(),
+							[this, &dim](const std::array<double, 3> &large) -> bool
+							{
+								return isPairable(dim, large);
+							}
+						))
+						isolatedVolume += dim[0] * dim[1] * dim[2] * (j - i);
+
+					i = j;
+				}
+
+			// TOLERATES ROUNDING ERRORS OF THE VOLUME
+			size_t volumeBound = (size_t)std::ceil(volume / sample->getContainableVolume() * (1.0 - 1e-9));
+			size_t largeBound = larges + (size_t)std::ceil(isolatedVolume / sample->getContainableVolume() * (1.0 - 1e-9));
+
+			return std::max({ volumeBound, largeBound, (size_t)1 });
+		};
+
+		/* -----------------------------------------------------------
+			SETTERS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Set type of the PackingEngine.
+		 *
+		 * @param val PackingEngine::BOXOLOGIC (default) or PackingEngine::EXTREME_POINT.
+		 */
+		void setEngine(int val)
+		{
+			engine = val;
+		};
+
 		/* -----------------------------------------------------------
 			OPERATORS
 		----------------------------------------------------------- */
@@ -176,14 +346,57 @@ namespace packer
 			if (sample->operator>=(*instance) == false)
 				return false;
 
+			allocateFeasible(instance, n);
+			return true;
+		};
+
+		/**
+		 * @brief Allocate instance(s), known to be enough small, to the WrapperGroup.
+		 *
+		 * @details Same with allocate(), but skips the inspection; the caller has inspected the instance
+		 *			already, by a FeasibilityMatrix.
+		 *
+		 * @param instance An Instance to allocate.
+		 * @param n Repeating number of the <i>instance</i>.
+		 */
+		void allocateFeasible(std::shared_ptr<Instance> instance, size_t n = 1)
+		{
+			// INSTANCES ALLOCATED BY SKU IDS BECOME OBJECTS
+			if (instanceTable != nullptr)
+			{
+				allocatedInstanceArray = getAllocatedInstanceArray();
+				instanceTable = nullptr;
+				allocatedSKUs.clear();
+			}
+
 			// INSERTS TO THE RESERVED ITEMS
 			this->allocatedInstanceArray->insert
 			(
 				allocatedInstanceArray->end(),
 				n, instance
 			);
+		};
 
-			return true;
+		/**
+		 * @brief Allocate instance(s), given by SKU id and known to be enough small, to the WrapperGroup.
+		 *
+		 * @details Same with allocateFeasible(instance, n), but the instance is represented by its SKU id.
+		 *			Instances allocated by SKU ids are packed by their ids, without shared pointers to the
+		 *			instances.
+		 *
+		 * @param instanceTable Distinct instances, containing the instance.
+		 * @param sku SKU id of the instance.
+		 * @param n Repeating number of the instance.
+		 */
+		void allocateFeasible(std::shared_ptr<InstanceTable> instanceTable, size_t sku, size_t n = 1)
+		{
+			if (this->instanceTable == nullptr && allocatedInstanceArray->empty() == true)
+				this->instanceTable = instanceTable;
+
+			if (this->instanceTable == instanceTable)
+				allocatedSKUs.insert(allocatedSKUs.end(), n, (uint32_t)sku);
+			else
+				allocateFeasible(instanceTable->getInstance(sku), n);
 		};
 		
 		/**
@@ -197,24 +410,249 @@ namespace packer
 		 *
 		 * <p> Repeats those steps until all instances are packed so that there's not any instance left. </p>
 		 *
+		 * <p> If the allocated instances are units of a SKU, full Wrappers are packed by packHomogeneous(), 
+		 * without repeating the packing process for each of them. </p>
+		 *
+		 * <p> If the <i>token</i> is expired, the PackingEngine winds up each Wrapper quickly. All instances
+		 * are packed still, but maybe into more Wrappers. </p>
+		 *
+		 * @param token Token of the optimization in progress. nullptr if not cancelable.
+		 *
 		 * @warning 
 		 * When call this optimize() method, ordinary children Wrapper objects in the WrapperGroup
 		 * will be substituted with the newly optimized Wrapper objects.
 		 */
-		void optimize()
+		void optimize(const CancelToken *token = nullptr)
 		{
 			// CLEAR PREVIOUS OPTIMIZATION
 			this->clear();
+			cancelToken = token;
+
+			if (instanceTable != nullptr)
+			{
+				// BY SKU IDS
+				std::vector<uint32_t> skus = allocatedSKUs;
+
+				if (skus.empty() == false
+					&& std::all_of(skus.begin(), skus.end(), [&skus](uint32_t sku) { return sku == skus.front(); }) == true)
+					skus.resize(packHomogeneous(instanceTable->getInstance(skus.front()), skus.size()));
+
+				while (skus.empty() == false)
+					this->pack(skus);
+
+				cancelToken = nullptr;
+				return;
+			}
 
 			// CONSTRUCT INSTANCES FROM RESERVEDS
 			std::shared_ptr<InstanceArray> instanceArray = this->allocatedInstanceArray;
 
+			if (instanceArray->empty() == false
+				&& std::all_of(instanceArray->begin(), instanceArray->end(), [&instanceArray](const std::shared_ptr<Instance> &instance)
+					{
+						return instance == instanceArray->front();
+					}) == true)
+			{
+				size_t left = packHomogeneous(instanceArray->front(), instanceArray->size());
+
+				instanceArray = std::make_shared<InstanceArray>();
+				instanceArray->assign(left, allocatedInstanceArray->front());
+			}
+
 			// UNTIL UNPACKED INSTANCE DOES NOT EXIST
 			while (instanceArray->empty() == false)
 				instanceArray = this->pack(instanceArray);
+
+			cancelToken = nullptr;
 		};
 
 	protected:
+		/**
+		 * @brief Wrap units of a SKU into full Wrappers.
+		 *
+		 * @details
+		 * <p> Packing processes of full Wrappers for a SKU are same each other; boxologic doesn't care how many
+		 * units are left, unless they're exhausted. Thus the first Wrapper is packed by the engine, and
+		 * copied while units are left more than the Wrapper contains. </p>
+		 *
+		 * <p> Before copying, a block pattern, units in an orientation aligned on a grid, is computed 
+		 * analytically. If the pattern contains more units than the engine, full Wrappers are filled by the
+		 * pattern instead. </p>
+		 *
+		 * @param instance The SKU.
+		 * @param n Number of the units.
+		 *
+		 * @return Number of units left, to be packed by the engine. Less than capacity of a full Wrapper.
+		 */
+		auto packHomogeneous(const std::shared_ptr<Instance> &instance, size_t n) -> size_t
+		{
+			// THE FIRST WRAPPER, BY THE ENGINE
+			std::shared_ptr<Wrapper> wrapper;
+			size_t left;
+
+			if (instanceTable != nullptr)
+			{
+				std::vector<uint32_t> skus(n, allocatedSKUs.front());
+
+				wrapper = getPackingEngine().pack(std::make_shared<Wrapper>(*sample), instanceTable, skus);
+				left = skus.size();
+			}
+			else
+			{
+				std::shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+				instanceArray->assign(n, instance);
+
+				auto pair = getPackingEngine().pack(std::make_shared<Wrapper>(*sample), instanceArray);
+				wrapper = pair.first;
+				left = pair.second->size();
+			}
+			size_t capacity = n - left;
+
+			// BLOCK PATTERN
+			std::array<double, 3> layout;
+			size_t blocks = computeBlocks(*instance, layout);
+
+			if (blocks > capacity && n >= blocks)
+			{
+				while (n >= blocks)
+				{
+					this->push_back(createBlocks(instance, layout));
+					n -= blocks;
+				}
+				return n;
+			}
+
+			// COPY THE FIRST WRAPPER
+			this->push_back(wrapper);
+			n = left;
+
+			while (capacity != 0 && n > capacity)
+			{
+				std::shared_ptr<Wrapper> copy(new Wrapper(*sample));
+				copy->reserve(wrapper->size());
+
+				for (size_t i = 0; i < wrapper->size(); i++)
+				{
+					const std::shared_ptr<Wrap> &wrap = wrapper->at(i);
+					copy->emplace_back(new Wrap(copy.get(), wrap->getInstance(), wrap->getX(), wrap->getY(), wrap->getZ(), wrap->getOrientation()));
+				}
+				this->push_back(copy);
+				n -= capacity;
+			}
+			return n;
+		};
+
+		/**
+		 * @brief Compute the best block pattern of a SKU.
+		 *
+		 * @param instance The SKU.
+		 * @param layout Dimensions of the SKU in orientation of the pattern, to be returned.
+		 *
+		 * @return Number of units in the pattern.
+		 */
+		auto computeBlocks(const Instance &instance, std::array<double, 3> &layout) const -> size_t
+		{
+			double w = instance.getWidth();
+			double h = instance.getHeight();
+			double l = instance.getLength();
+
+			double orientations[6][3] =
+			{
+				{ w, h, l }, { l, h, w }, { l, w, h },
+				{ h, w, l }, { w, l, h }, { h, l, w }
+			};
+			size_t best = 0;
+
+			for (size_t o = 0; o < 6; o++)
+			{
+				size_t count = (size_t)std::floor(sample->getContainableWidth() / orientations[o][0])
+					* (size_t)std::floor(sample->getContainableHeight() / orientations[o][1])
+					* (size_t)std::floor(sample->getContainableLength() / orientations[o][2]);
+
+				if (count > best)
+				{
+					best = count;
+					layout = { orientations[o][0], orientations[o][1], orientations[o][2] };
+				}
+			}
+			return best;
+		};
+
+		/**
+		 * @brief Test whether two instances can be placed in a Wrapper together.
+		 *
+		 * @details
+		 * <p> Two boxes which don't overlap are separated along an axis. Thus they can share a Wrapper if and 
+		 * only if, in some orientations, their dimensions are summed within the Wrapper on an axis, while each 
+		 * of them is within the Wrapper on the other axes. </p>
+		 *
+		 * @param x Sorted dimensions of an instance.
+		 * @param y Sorted dimensions of another instance.
+		 */
+		auto isPairable(std::array<double, 3> x, std::array<double, 3> y) const -> bool
+		{
+			// TOLERATES ROUNDING ERRORS; A LOWER BOUND MUST NOT BE OVERESTIMATED
+			std::array<double, 3> space =
+			{
+				sample->getContainableWidth() * (1.0 + 1e-9),
+				sample->getContainableHeight() * (1.0 + 1e-9),
+				sample->getContainableLength() * (1.0 + 1e-9)
+			};
+
+			do
+			{
+				if (x[0] > space[0] || x[1] > space[1] || x[2] > space[2])
+					continue;
+
+				do
+				{
+					if (y[0] > space[0] || y[1] > space[1] || y[2] > space[2])
+						continue;
+
+					for (size_t k = 0; k < 3; k++)
+						if (x[k] + y[k] <= space[k])
+							return true;
+				} while (std::next_permutation(y.begin(), y.end()));
+			} while (std::next_permutation(x.begin(), x.end()));
+
+			return false;
+		};
+
+		/**
+		 * @brief Create a Wrapper filled by a block pattern.
+		 *
+		 * @param instance The SKU.
+		 * @param layout Dimensions of the SKU in orientation of the pattern.
+		 */
+		auto createBlocks(const std::shared_ptr<Instance> &instance, const std::array<double, 3> &layout) const -> std::shared_ptr<Wrapper>
+		{
+			std::shared_ptr<Wrapper> wrapper(new Wrapper(*sample));
+			double thickness = sample->getThickness();
+
+			size_t nx = (size_t)std::floor(sample->getContainableWidth() / layout[0]);
+			size_t ny = (size_t)std::floor(sample->getContainableHeight() / layout[1]);
+			size_t nz = (size_t)std::floor(sample->getContainableLength() / layout[2]);
+
+			wrapper->reserve(nx * ny * nz);
+
+			for (size_t z = 0; z < nz; z++)
+				for (size_t y = 0; y < ny; y++)
+					for (size_t x = 0; x < nx; x++)
+					{
+						Wrap *wrap = new Wrap
+						(
+							wrapper.get(), instance, 
+							x * layout[0] + thickness, 
+							y * layout[1] + thickness, 
+							z * layout[2] + thickness
+						);
+						wrap->estimateOrientation(layout[0], layout[1], layout[2]);
+
+						wrapper->emplace_back(wrap);
+					}
+			return wrapper;
+		};
+
 		/**
 		 * @brief Wrap allocated instances into <b>a new</b> Wrapper.
 		 *
@@ -230,13 +668,43 @@ namespace packer
 		 */
 		virtual auto pack(std::shared_ptr<InstanceArray> instanceArray) -> std::shared_ptr<InstanceArray>
 		{
-			boxologic::Boxologic adaptor(std::make_shared<Wrapper>(*sample), instanceArray);
-			auto pair = adaptor.pack();
+			auto pair = getPackingEngine().pack(std::make_shared<Wrapper>(*sample), instanceArray);
 
 			this->push_back(pair.first);
 			return pair.second;
 		};
 
+		/**
+		 * @brief Wrap allocated instances, given by SKU ids, into <b>a new</b> Wrapper.
+		 *
+		 * @details Same with pack(instanceArray), but the instances are represented by SKU ids in the
+		 *			#instanceTable.
+		 *
+		 * @param skus SKU ids of instances to wrap. After wrapping, SKU ids of instances failed to wrap.
+		 */
+		void pack(std::vector<uint32_t> &skus)
+		{
+			this->push_back(getPackingEngine().pack(std::make_shared<Wrapper>(*sample), instanceTable, skus));
+		};
+
+		/**
+		 * @brief Get the packing engine of the current thread, of the #engine type.
+		 *
+		 * @details An engine per thread and type, of which buffers are reused by following packings.
+		 */
+		auto getPackingEngine() const -> PackingEngine&
+		{
+			static thread_local boxologic::Boxologic boxologic;
+			static thread_local ExtremePoint extremePoint;
+
+			PackingEngine &packingEngine = (engine == PackingEngine::EXTREME_POINT)
+				? (PackingEngine&)extremePoint
+				: (PackingEngine&)boxologic;
+
+			packingEngine.setCancelToken(cancelToken);
+			return packingEngine;
+		};
+
 	public:
 		/* -----------------------------------------------------------
 			EXPORTERS
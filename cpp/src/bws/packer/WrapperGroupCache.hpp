@@ -0,0 +1,157 @@
+#pragma once
+#include <bws/packer/API.hpp>
+
+#include <bws/packer/WrapperGroup.hpp>
+
+#include <string>
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <samchon/library/RWMutex.hpp>
+#include <samchon/library/UniqueReadLock.hpp>
+#include <samchon/library/UniqueWriteLock.hpp>
+
+namespace bws
+{
+namespace packer
+{
+	/**
+	 * @brief A memo of optimized WrapperGroup objects.
+	 *
+	 * @details
+	 * <p> WrapperGroupCache stores results of WrapperGroup::optimize() with a key, a pair of type of the
+	 * Wrapper and (sorted) multi-set of instances allocated to the WrapperGroup. Sequence lists of genetic
+	 * algorithm differ from each other in a few genes, so that most of their {@link WrapperGroup groups}
+	 * repeat. The packing process of a repeated group can be skipped by the memo. </p>
+	 *
+	 * <p> The memo is shared by all {@link GAWrapperArray sequence lists} in a population and across
+	 * generations. It is thread-safe; reading and writing are guarded by a RWMutex. When size of the
+	 * memo exceeds its capacity, the oldest record is erased first. </p>
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class WrapperGroupCache
+	{
+	public:
+		/**
+		 * @brief Key of a record.
+		 *
+		 * @details Key of the Wrapper and ranks of allocated instances, sorted in ascending order.
+		 */
+		struct Key
+		{
+			std::string wrapper;
+			std::vector<size_t> instances;
+
+			auto operator==(const Key &obj) const -> bool
+			{
+				return wrapper == obj.wrapper && instances == obj.instances;
+			};
+		};
+
+		/**
+		 * @brief Hash function of the Key.
+		 */
+		struct Hasher
+		{
+			auto operator()(const Key &key) const -> size_t
+			{
+				size_t hash = std::hash<std::string>()(key.wrapper);
+
+				for (size_t i = 0; i < key.instances.size(); i++)
+					hash ^= key.instances[i] + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+				return hash;
+			};
+		};
+
+	private:
+		/**
+		 * @brief Optimized WrapperGroup objects.
+		 */
+		std::unordered_map<Key, std::shared_ptr<WrapperGroup>, Hasher> dictionary;
+
+		/**
+		 * @brief Keys in order of insertion, to erase the oldest record.
+		 */
+		std::queue<Key> history;
+
+		/**
+		 * @brief Maximum number of records.
+		 */
+		size_t capacity;
+
+		/**
+		 * @brief Mutex for the dictionary and history.
+		 */
+		library::RWMutex mtx;
+
+	public:
+		/* -----------------------------------------------------------
+			CONSTRUCTORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Construct from capacity.
+		 *
+		 * @param capacity Maximum number of records.
+		 */
+		WrapperGroupCache(size_t capacity = 10000)
+		{
+			this->capacity = capacity;
+		};
+
+		/* -----------------------------------------------------------
+			ACCESSORS
+		----------------------------------------------------------- */
+		/**
+		 * @brief Get an optimized WrapperGroup.
+		 *
+		 * @param key Key of the record.
+		 * @return The optimized WrapperGroup. nullptr if there's not the record.
+		 */
+		auto get(const Key &key) const -> std::shared_ptr<WrapperGroup>
+		{
+			library::UniqueReadLock uk(mtx);
+
+			auto it = dictionary.find(key);
+			if (it == dictionary.end())
+				return nullptr;
+			else
+				return it->second;
+		};
+
+		/**
+		 * @brief Insert an optimized WrapperGroup.
+		 *
+		 * @details If the key already exists, the record is not replaced.
+		 *
+		 * @param key Key of the record.
+		 * @param wrapperGroup The optimized WrapperGroup.
+		 */
+		void insert(const Key &key, std::shared_ptr<WrapperGroup> wrapperGroup)
+		{
+			library::UniqueWriteLock uk(mtx);
+
+			if (dictionary.insert({ key, wrapperGroup }).second == false)
+				return;
+
+			history.push(key);
+			while (dictionary.size() > capacity)
+			{
+				dictionary.erase(history.front());
+				history.pop();
+			}
+		};
+
+		/**
+		 * @brief Get number of records.
+		 */
+		auto size() const -> size_t
+		{
+			library::UniqueReadLock uk(mtx);
+
+			return dictionary.size();
+		};
+	};
+};
+};
@@ -124,7 +124,7 @@ namespace samchon
 		 */
 		auto has(const Key &key) const -> bool
 		{
-			return count(key) != 0;
+			return this->count(key) != 0;
 		};
 
 		/**
@@ -143,11 +143,11 @@ namespace samchon
 		 */
 		auto get(const Key &key) -> T&
 		{
-			return find(key)->second;
+			return this->find(key)->second;
 		};
 		auto get(const Key &key) const -> const T&
 		{
-			return find(key)->second;
+			return this->find(key)->second;
 		};
 
 		/**
@@ -164,19 +164,19 @@ namespace samchon
 		 */
 		void set(const Key &key, const T &val)
 		{
-			iterator it = find(key);
-			if (it != end())
-				erase(it);
+			typename super::iterator it = this->find(key);
+			if (it != this->end())
+				this->erase(it);
 
-			insert({ key, val });
+			this->insert({ key, val });
 		};
 		void set(const Key &key, const T &&val)
 		{
-			iterator it = find(key);
-			if (it != end())
-				erase(it);
+			typename super::iterator it = this->find(key);
+			if (it != this->end())
+				this->erase(it);
 
-			insert({ key, val });
+			this->insert({ key, val });
 		};
 
 		/**
@@ -187,10 +187,10 @@ namespace samchon
 		 */
 		auto pop(const Key &key) -> T
 		{
-			iterator it = find(key);
+			typename super::iterator it = this->find(key);
 			T val = it->second;
 
-			erase(it);
+			this->erase(it);
 
 			return val;
 		};
@@ -344,7 +344,7 @@ namespace samchon
 			for (size_t i = 0; i < delims.size(); i++)
 				positionVector.push_back(find(delims[i], startIndex));
 
-			IndexPair<size_t> &iPair = library::Math::minimum(positionVector);
+			IndexPair<size_t> iPair = library::Math::minimum(positionVector);
 			return { iPair.get_index(), delims[iPair.getValue()] };
 		};
 
@@ -390,7 +390,7 @@ namespace samchon
 			if (positionVector.empty() == true)
 				return { std::string::npos, WeakString() };
 
-			IndexPair<size_t> &iPair = library::Math::maximum(positionVector);
+			IndexPair<size_t> iPair = library::Math::maximum(positionVector);
 			return { iPair.get_index(), delims[iPair.getValue()] };
 		};
 
@@ -850,7 +850,7 @@ namespace samchon
 		 */
 		auto toLowerCase() const -> std::string
 		{
-			std::string &str = this->str();
+			std::string str = this->str();
 
 			for (size_t i = 0; i < str.size(); i++)
 				if ('A' <= str[i] && str[i] <= 'Z')
@@ -868,7 +868,7 @@ namespace samchon
 		 */
 		auto yoUpperCase() const -> std::string
 		{
-			std::string &str = this->str();
+			std::string str = this->str();
 
 			for (size_t i = 0; i < str.size(); i++)
 				if ('a' <= str[i] && str[i] <= 'z')
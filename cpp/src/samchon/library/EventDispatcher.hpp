@@ -9,6 +9,7 @@
 #include <functional>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 
 #include <samchon/library/RWMutex.hpp>
 #include <samchon/library/Event.hpp>
@@ -250,27 +251,30 @@ namespace library
 			static bool flag = false;
 			return flag;
 		};
+
+		// OBJECTS SHARED WITH THE DETACHED THREADS ARE NEVER DESTROYED;
+		// DESTROYING A CONDITION VARIABLE THEY WAIT ON BLOCKS THE EXIT OF THE PROCESS
 		static std::condition_variable& cv()
 		{
-			static std::condition_variable obj;
-			return obj;
+			static std::condition_variable *obj = new std::condition_variable();
+			return *obj;
 		};
 		static std::mutex& cv_mtx()
 		{
-			static std::mutex obj;
-			return obj;
+			static std::mutex *obj = new std::mutex();
+			return *obj;
 		};
 
 		static std::unordered_multimap<EventDispatcher*, std::shared_ptr<Event>>& eventMap()
 		{
-			static std::unordered_multimap<EventDispatcher*, std::shared_ptr<Event>> map;
-			return map;
+			static std::unordered_multimap<EventDispatcher*, std::shared_ptr<Event>> *map = new std::unordered_multimap<EventDispatcher*, std::shared_ptr<Event>>();
+			return *map;
 		};
 
 		static std::mutex& sMtx()
 		{
-			static std::mutex obj;
-			return obj;
+			static std::mutex *obj = new std::mutex();
+			return *obj;
 		};
 
 		static void start()
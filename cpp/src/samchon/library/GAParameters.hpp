@@ -52,6 +52,54 @@ namespace library
 		 */
 		double mutationRate;
 
+		/**
+		 * @brief A number of threads evaluating a generation.
+		 *
+		 * @details
+		 * <p> Fitness of each individual in a generation is evaluated in parallel by the number of threads. </p>
+		 *	\li 0 means the number of threads is determined by the system (OpenMP's default).
+		 */
+		size_t threads;
+
+		/**
+		 * @brief Time budget of the evolution, in milliseconds.
+		 *
+		 * @details
+		 * <p> Evolution stops when the time budget is exhausted, even if the number of {@link generation} is
+		 * not reached. The best individual found until then is the result. </p>
+		 *	\li 0 means no time limit.
+		 */
+		size_t timeout;
+
+		/**
+		 * @brief Seed of random number generation.
+		 *
+		 * @details
+		 * <p> Random numbers used in the evolution are derived from the seed, so that evolutions with the same
+		 * seed and parameters deduct the same result. </p>
+		 */
+		size_t seed;
+
+		/**
+		 * @brief A number of islands.
+		 *
+		 * @details
+		 * <p> The population is divided into the islands (sub-populations), which evolve independently in
+		 * parallel. Elites of each island migrate to the next island periodically. </p>
+		 *	\li 1 means a single population, without migration.
+		 */
+		size_t islands;
+
+		/**
+		 * @brief Interval of migration, in generations.
+		 */
+		size_t migrationInterval;
+
+		/**
+		 * @brief A number of migrants, elites moving from an island to the next one in a migration.
+		 */
+		size_t migrants;
+
 	public:
 		/* ===========================================================
 			CONSTRUCTORS & SETTERS
@@ -76,6 +124,14 @@ namespace library
 			this->population = population;
 			this->tournament = tournament;
 			this->mutationRate = mutationRate;
+
+			this->threads = 0;
+			this->timeout = 0;
+			this->seed = 0;
+
+			this->islands = 1;
+			this->migrationInterval = 10;
+			this->migrants = 1;
 		};
 
 		virtual void construct(std::shared_ptr<XML> xml) override
@@ -84,6 +140,15 @@ namespace library
 			population = xml->getProperty<size_t>("population");
 			tournament = xml->getProperty<size_t>("tournament");
 			mutationRate = xml->getProperty<double>("mutationRate");
+
+			// OPTIONAL PROPERTIES
+			threads = xml->hasProperty("threads") ? xml->getProperty<size_t>("threads") : 0;
+			timeout = xml->hasProperty("timeout") ? xml->getProperty<size_t>("timeout") : 0;
+			seed = xml->hasProperty("seed") ? xml->getProperty<size_t>("seed") : 0;
+
+			islands = xml->hasProperty("islands") ? xml->getProperty<size_t>("islands") : 1;
+			migrationInterval = xml->hasProperty("migrationInterval") ? xml->getProperty<size_t>("migrationInterval") : 10;
+			migrants = xml->hasProperty("migrants") ? xml->getProperty<size_t>("migrants") : 1;
 		};
 
 		/* -----------------------------------------------------------
@@ -121,6 +186,54 @@ namespace library
 			mutationRate = val;
 		}
 
+		/**
+		 * Set number of threads.
+		 */
+		void setThreads(size_t val)
+		{
+			threads = val;
+		}
+
+		/**
+		 * Set time budget in milliseconds.
+		 */
+		void setTimeout(size_t val)
+		{
+			timeout = val;
+		}
+
+		/**
+		 * Set seed of random number generation.
+		 */
+		void setSeed(size_t val)
+		{
+			seed = val;
+		}
+
+		/**
+		 * Set number of islands.
+		 */
+		void setIslands(size_t val)
+		{
+			islands = val;
+		}
+
+		/**
+		 * Set interval of migration.
+		 */
+		void setMigrationInterval(size_t val)
+		{
+			migrationInterval = val;
+		}
+
+		/**
+		 * Set number of migrants.
+		 */
+		void setMigrants(size_t val)
+		{
+			migrants = val;
+		}
+
 		/* -----------------------------------------------------------
 			GETTERS
 		----------------------------------------------------------- */
@@ -156,6 +269,54 @@ namespace library
 			return mutationRate;
 		};
 
+		/**
+		 * Get number of threads.
+		 */
+		auto getThreads() const -> size_t
+		{
+			return threads;
+		};
+
+		/**
+		 * Get time budget in milliseconds.
+		 */
+		auto getTimeout() const -> size_t
+		{
+			return timeout;
+		};
+
+		/**
+		 * Get seed of random number generation.
+		 */
+		auto getSeed() const -> size_t
+		{
+			return seed;
+		};
+
+		/**
+		 * Get number of islands.
+		 */
+		auto getIslands() const -> size_t
+		{
+			return islands;
+		};
+
+		/**
+		 * Get interval of migration.
+		 */
+		auto getMigrationInterval() const -> size_t
+		{
+			return migrationInterval;
+		};
+
+		/**
+		 * Get number of migrants.
+		 */
+		auto getMigrants() const -> size_t
+		{
+			return migrants;
+		};
+
 		/* -----------------------------------------------------------
 			EXPORTERS
 		----------------------------------------------------------- */
@@ -165,11 +326,17 @@ namespace library
 		};
 		virtual auto toXML() const -> std::shared_ptr<library::XML> override
 		{
-			std::shared_ptr<XML> &xml = super::toXML();
+			std::shared_ptr<XML> xml = super::toXML();
 			xml->setProperty("generation", generation);
 			xml->setProperty("population", population);
 			xml->setProperty("tournament", tournament);
 			xml->setProperty("mutationRate", mutationRate);
+			xml->setProperty("threads", threads);
+			xml->setProperty("timeout", timeout);
+			xml->setProperty("seed", seed);
+			xml->setProperty("islands", islands);
+			xml->setProperty("migrationInterval", migrationInterval);
+			xml->setProperty("migrants", migrants);
 
 			return xml;
 		};
@@ -4,6 +4,8 @@
 #include <functional>
 #include <memory>
 #include <vector>
+#include <cmath>
+#include <limits>
 
 namespace samchon
 {
@@ -56,7 +58,7 @@ namespace library
 	template <typename GeneArray, typename Compare = std::less<GeneArray>>
 	class GAPopulation
 	{
-		template <typename GeneArray, typename Compare>
+		template <typename, typename>
 		friend class GeneticAlgorithm;
 
 	private:
@@ -65,6 +67,50 @@ namespace library
 		 */
 		std::vector<std::shared_ptr<GeneArray>> children;
 
+		/**
+		 * @brief Sequence number of the generation
+		 *
+		 * @details The initial population is the 0th generation. Random numbers of an evolution are
+		 * derived from the sequence number, so that each generation has its own random streams.
+		 */
+		size_t generation;
+
+		/**
+		 * @brief Index of the island
+		 *
+		 * @details In an island model, the population is an island, one of sub-populations evolving
+		 * independently. Random numbers of an evolution are also derived from the index.
+		 */
+		size_t island;
+
+		/**
+		 * @brief Ranks of the children
+		 *
+		 * @details
+		 * <p> Rank of the best child is 0. Ranks are computed once in a generation by rank(), so that
+		 * tournaments in selection compare only integers, without comparing GeneArray objects. </p>
+		 */
+		std::vector<size_t> ranks;
+
+		/**
+		 * @brief Indices of the children, the best one first
+		 *
+		 * @details Computed with #ranks by rank().
+		 */
+		std::vector<size_t> order;
+
+		/**
+		 * @brief Fitness of the children
+		 *
+		 * @details
+		 * <p> Scalar fitness of each child; the lower, the better. A child not evaluated yet, or whose 
+		 * GeneArray cannot be scored by a scalar, has <i>NaN</i>. </p>
+		 *
+		 * <p> When all children have their fitness, fitTest() and rank() compare the fitness values
+		 * instead of comparing GeneArray objects by Compare. </p>
+		 */
+		std::vector<double> fitnesses;
+
 		/**
 		 * @brief Private Constructor with population
 		 *
@@ -78,6 +124,9 @@ namespace library
 		GAPopulation(size_t size)
 		{
 			children.assign(size, nullptr);
+			fitnesses.assign(size, std::numeric_limits<double>::quiet_NaN());
+			generation = 0;
+			island = 0;
 		};
 
 	public:
@@ -97,6 +146,9 @@ namespace library
 		GAPopulation(std::shared_ptr<GeneArray> geneArray, size_t size)
 		{
 			children.reserve(size);
+			fitnesses.assign(size, std::numeric_limits<double>::quiet_NaN());
+			generation = 0;
+			island = 0;
 
 			for (size_t i = 0; i < size; i++)
 			{
@@ -109,6 +161,35 @@ namespace library
 			}
 		};
 
+		/**
+		 * @brief Construct from a GeneArray, size of the population and a diversifier
+		 *
+		 * @details
+		 * <p> Same with GAPopulation(std::shared_ptr<GeneArray>, size_t) but diversifies the genes by the
+		 * given function instead of shuffling, for a representation of genes which cannot be shuffled. </p>
+		 *
+		 * @param geneArray An initial sequence listing
+		 * @param size The size of population to have as children
+		 * @param diversify A function diversifying a copy of the initial sequence listing
+		 */
+		GAPopulation(std::shared_ptr<GeneArray> geneArray, size_t size, std::function<void(std::shared_ptr<GeneArray>)> diversify)
+		{
+			children.reserve(size);
+			fitnesses.assign(size, std::numeric_limits<double>::quiet_NaN());
+			generation = 0;
+			island = 0;
+
+			for (size_t i = 0; i < size; i++)
+			{
+				std::shared_ptr<GeneArray> ptr(new GeneArray(*geneArray));
+
+				if (i > 0) //FOR ELITICISM
+					diversify(ptr);
+
+				children.push_back(ptr);
+			}
+		};
+
 		/**
 		 * @brief Test fitness of each GeneArray in the population.
 		 *
@@ -116,6 +197,16 @@ namespace library
 		 */
 		auto fitTest() const -> std::shared_ptr<GeneArray>
 		{
+			if (isEvaluated() == true)
+			{
+				size_t index = 0;
+				for (size_t i = 1; i < children.size(); i++)
+					if (fitnesses[i] < fitnesses[index])
+						index = i;
+
+				return children[index];
+			}
+
 			std::shared_ptr<GeneArray> best = children[0];
 
 			for (size_t i = 1; i < children.size(); i++)
@@ -124,6 +215,47 @@ namespace library
 
 			return best;
 		};
+
+	private:
+		/**
+		 * @brief Compute ranks of the children
+		 *
+		 * @details Children are sorted by their fitness (or by Compare if they don't have fitness);
+		 * equivalent children are ranked by their indices.
+		 */
+		void rank()
+		{
+			order.resize(children.size());
+			for (size_t i = 0; i < order.size(); i++)
+				order[i] = i;
+
+			if (isEvaluated() == true)
+				std::stable_sort(order.begin(), order.end(), [this](size_t x, size_t y) -> bool
+					{
+						return fitnesses[x] < fitnesses[y];
+					});
+			else
+				std::stable_sort(order.begin(), order.end(), [this](size_t x, size_t y) -> bool
+					{
+						return Compare()(*children[x], *children[y]);
+					});
+
+			ranks.assign(children.size(), 0);
+			for (size_t i = 0; i < order.size(); i++)
+				ranks[order[i]] = i;
+		};
+
+		/**
+		 * @brief Whether all children have their scalar fitness
+		 */
+		auto isEvaluated() const -> bool
+		{
+			for (size_t i = 0; i < fitnesses.size(); i++)
+				if (std::isnan(fitnesses[i]) == true)
+					return false;
+
+			return true;
+		};
 	};
 };
 };
\ No newline at end of file
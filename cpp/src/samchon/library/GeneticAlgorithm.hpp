@@ -1,10 +1,20 @@
 #pragma once
 
 #include <samchon/library/GAPopulation.hpp>
+#include <samchon/library/GAParameters.hpp>
 
 #include <set>
+#include <vector>
+#include <cmath>
+#include <limits>
 #include <random>
+#include <algorithm>
 #include <samchon/library/Math.hpp>
+#include <samchon/library/Random.hpp>
+
+#ifdef _OPENMP
+#	include <omp.h>
+#endif
 
 namespace samchon
 {
@@ -62,6 +72,13 @@ namespace library
 	public:
 		typedef GAPopulation<GeneArray, Compare> Population;
 
+		/**
+		 * @brief Type of random engine used in the evolution
+		 *
+		 * @details Each child of a generation has its own engine, seeded by (seed, island, generation, index).
+		 */
+		typedef Random Engine;
+
 	protected:
 		/**
 		 * @brief Whether each element (Gene) is unique in their GeneArray
@@ -86,6 +103,42 @@ namespace library
 		 */
 		size_t tournament;
 
+		/**
+		 * @brief Number of threads evolving a population
+		 *
+		 * @details 0 means default number of threads of OpenMP.
+		 */
+		size_t threads;
+
+		/**
+		 * @brief Seed of random engines
+		 *
+		 * @details
+		 * <p> Random numbers are derived from the seed, the sequence number of generation and index of the
+		 * child. Thus, result of an evolution is reproducible by the seed, regardless of the number of
+		 * threads. </p>
+		 */
+		size_t seed;
+
+		/**
+		 * @brief Number of islands
+		 *
+		 * @details Sub-populations evolving independently in parallel.
+		 */
+		size_t islands;
+
+		/**
+		 * @brief Interval of migration, in generations
+		 *
+		 * @details 0 means no migration.
+		 */
+		size_t migrationInterval;
+
+		/**
+		 * @brief Number of elites migrating from an island to the next one
+		 */
+		size_t migrants;
+
 	public:
 		/**
 		 * @brief Construct from parameters of Genetic Algorithm
@@ -99,6 +152,79 @@ namespace library
 			this->unique = unique;
 			this->mutationRate = mutationRate;
 			this->tournament = tournament;
+
+			this->threads = 0;
+			this->seed = 0;
+
+			this->islands = 1;
+			this->migrationInterval = 0;
+			this->migrants = 0;
+		};
+
+		/**
+		 * @brief Construct from parameters of Genetic Algorithm
+		 *
+		 * @param unique Whether each Gene is unique in their GeneArray
+		 * @param gaParams Parameters of Genetic Algorithm
+		 */
+		GeneticAlgorithm(bool unique, const GAParameters &gaParams)
+			: GeneticAlgorithm(unique, gaParams.getMutationRate(), gaParams.getTournament())
+		{
+			this->threads = gaParams.getThreads();
+			this->seed = gaParams.getSeed();
+
+			this->islands = std::max<size_t>(gaParams.getIslands(), 1);
+			this->migrationInterval = gaParams.getMigrationInterval();
+			this->migrants = gaParams.getMigrants();
+		};
+
+		virtual ~GeneticAlgorithm() = default;
+
+		/**
+		 * @brief Create an initial population
+		 *
+		 * @details Diversifies the individual by an engine derived from the seed.
+		 *
+		 * @param individual An initial set of genes; sequence listing
+		 * @param population Size of population in a generation
+		 */
+		auto createPopulation(std::shared_ptr<GeneArray> individual, size_t population) const -> std::shared_ptr<Population>
+		{
+			Engine engine = createEngine(0, 0, 0);
+
+			return std::shared_ptr<Population>(new Population(individual, population, [this, &engine](std::shared_ptr<GeneArray> genes)
+				{
+					diversify(genes, engine);
+				}));
+		};
+
+		/**
+		 * @brief Create initial islands
+		 *
+		 * @details
+		 * <p> Divides the population into the #islands. Each island is a population diversifying the 
+		 * individual by its own random engine. </p>
+		 *
+		 * @param individual An initial set of genes; sequence listing
+		 * @param population Size of the whole population in a generation
+		 */
+		auto createIslands(std::shared_ptr<GeneArray> individual, size_t population) const -> std::vector<std::shared_ptr<Population>>
+		{
+			size_t size = std::max<size_t>((population + islands - 1) / islands, 2);
+			std::vector<std::shared_ptr<Population>> archipelago;
+
+			for (size_t i = 0; i < islands; i++)
+			{
+				Engine engine = createEngine(i, 0, 0);
+				std::shared_ptr<Population> island(new Population(individual, size, [this, &engine](std::shared_ptr<GeneArray> genes)
+					{
+						diversify(genes, engine);
+					}));
+				island->island = i;
+
+				archipelago.push_back(island);
+			}
+			return archipelago;
 		};
 
 		/**
@@ -113,7 +239,7 @@ namespace library
 		 */
 		inline auto evolveGeneArray(std::shared_ptr<GeneArray> individual, size_t population, size_t generation) const -> std::shared_ptr<GeneArray>
 		{
-			std::shared_ptr<Population> myPopulation(new Population(individual, population));
+			std::shared_ptr<Population> myPopulation = createPopulation(individual, population);
 
 			for (size_t i = 0; i < generation; i++)
 				myPopulation = evolvePopulation(myPopulation);
@@ -128,32 +254,168 @@ namespace library
 		 */
 		auto evolvePopulation(std::shared_ptr<Population> population) const -> std::shared_ptr<Population>
 		{
-			size_t size = population->children.size();
+			return evolve(population, true);
+		};
+
+		/**
+		 * @brief Evolve islands
+		 *
+		 * @details
+		 * <p> Each island evolves a generation independently, in parallel. Then elites of each island
+		 * migrate to the next island (ring topology) in every #migrationInterval generations. A migrant
+		 * replaces one of the worst children of the next island. Migrants are evaluated already, so
+		 * they are shared by the islands without copying. </p>
+		 *
+		 * <p> When there's only an island, it's same with evolvePopulation(). </p>
+		 *
+		 * @param archipelago Islands to evolve
+		 * @return Evolved islands
+		 */
+		auto evolveIslands(const std::vector<std::shared_ptr<Population>> &archipelago) const -> std::vector<std::shared_ptr<Population>>
+		{
+			int size = (int)archipelago.size();
+			std::vector<std::shared_ptr<Population>> evolved(size);
+
+			if (size == 1)
+				evolved[0] = evolve(archipelago[0], true);
+			else
+			{
+				#pragma omp parallel for num_threads(getThreads()) schedule(dynamic)
+				for (int i = 0; i < size; i++)
+					evolved[i] = evolve(archipelago[i], false);
+			}
+
+			// MIGRATION
+			if (migrationInterval != 0 && evolved[0]->generation % migrationInterval == 0)
+				migrate(evolved);
+
+			return evolved;
+		};
+
+		/**
+		 * @brief Test fitness of islands
+		 *
+		 * @param archipelago Islands to test
+		 * @return The best GeneArray in the islands
+		 */
+		auto fitTest(const std::vector<std::shared_ptr<Population>> &archipelago) const -> std::shared_ptr<GeneArray>
+		{
+			std::shared_ptr<GeneArray> best = archipelago[0]->fitTest();
+
+			for (size_t i = 1; i < archipelago.size(); i++)
+			{
+				std::shared_ptr<GeneArray> myBest = archipelago[i]->fitTest();
+
+				if (Compare()(*myBest, *best) == true)
+					best = myBest;
+			}
+			return best;
+		};
+
+		/**
+		 * @brief Get number of threads evolving a population
+		 *
+		 * @details Not more than omp_get_max_threads(); more threads than the limit only oversubscribe the
+		 * cores shared with other solvers.
+		 */
+		auto getThreads() const -> int
+		{
+#ifdef _OPENMP
+			if (threads == 0)
+				return omp_get_max_threads();
+			else
+				return std::min<int>((int)threads, omp_get_max_threads());
+#else
+			return 1;
+#endif
+		};
+
+	private:
+		/**
+		 * @brief Evolve a population a generation
+		 *
+		 * @param population A population to evolve
+		 * @param parallel Whether to evolve children in parallel
+		 */
+		auto evolve(std::shared_ptr<Population> population, bool parallel) const -> std::shared_ptr<Population>
+		{
+			int size = (int)population->children.size();
 			std::shared_ptr<Population> evolved(new Population(size));
+			evolved->generation = population->generation + 1;
+			evolved->island = population->island;
+
+			// EVALUATE FITNESS OF THE PARENTS, WHICH ARE NOT EVALUATED YET
+			#pragma omp parallel for num_threads(getThreads()) schedule(dynamic) if(parallel)
+			for (int i = 0; i < size; i++)
+				if (std::isnan(population->fitnesses[i]) == true)
+					population->fitnesses[i] = evaluate(population->children[i]);
+
+			population->rank();
 
 			//ELITICISM
-			evolved->children[0] = population->fitTest();
+			size_t elite = population->order[0];
+			evolved->children[0] = population->children[elite];
+			evolved->fitnesses[0] = population->fitnesses[elite];
 
-			#pragma omp parallel for
+			#pragma omp parallel for num_threads(getThreads()) schedule(dynamic) if(parallel)
 			for (int i = 1; i < size; i++)
 			{
-				std::shared_ptr<GeneArray> &gene1 = selection(population);
-				std::shared_ptr<GeneArray> &gene2 = selection(population);
+				Engine engine = createEngine(evolved->island, evolved->generation, i);
+
+				const std::shared_ptr<GeneArray> &gene1 = population->children[selection(*population, engine)];
+				const std::shared_ptr<GeneArray> &gene2 = population->children[selection(*population, engine)];
 
-				std::shared_ptr<GeneArray> &child = crossover(gene1, gene2);
-				mutate(child);
+				std::shared_ptr<GeneArray> child = crossover(gene1, gene2, engine);
+				mutate(child, engine);
 
 				evolved->children[i] = child;
+				evolved->fitnesses[i] = evaluate(child);
 			}
 
-			/*#pragma omp parallel for
-			for (int i = 1; i < size; i++)
-				mutate(evolved->children[i]);*/
-
 			return evolved;
 		};
 
-	private:
+		/**
+		 * @brief Migrate elites of each island to the next island
+		 *
+		 * @param archipelago Islands, of which children are evaluated
+		 */
+		void migrate(std::vector<std::shared_ptr<Population>> &archipelago) const
+		{
+			size_t size = archipelago.size();
+			if (size < 2 || migrants == 0)
+				return;
+
+			// RANK CHILDREN OF EACH ISLAND
+			for (size_t i = 0; i < size; i++)
+				archipelago[i]->rank();
+
+			// FETCH ELITES BEFORE REPLACING
+			size_t count = std::min(migrants, archipelago[0]->children.size() - 1);
+			std::vector<std::vector<std::pair<std::shared_ptr<GeneArray>, double>>> elites(size);
+
+			for (size_t i = 0; i < size; i++)
+				for (size_t j = 0; j < count; j++)
+				{
+					size_t index = archipelago[i]->order[j];
+					elites[i].emplace_back(archipelago[i]->children[index], archipelago[i]->fitnesses[index]);
+				}
+
+			// ELITES OF AN ISLAND REPLACE THE WORSTS OF THE NEXT ISLAND
+			for (size_t i = 0; i < size; i++)
+			{
+				Population &next = *archipelago[(i + 1) % size];
+
+				for (size_t j = 0; j < count; j++)
+				{
+					size_t index = next.order[next.order.size() - 1 - j];
+
+					next.children[index] = elites[i][j].first;
+					next.fitnesses[index] = elites[i][j].second;
+				}
+			}
+		};
+
 		/**
 		 * @brief Select the best GeneArray in population from tournament
 		 *
@@ -181,25 +443,34 @@ namespace library
 		 *
 		 *	\li Referenced Wekipedia: https://en.wikipedia.org/wiki/Selection_(genetic_algorithm)
 		 *
+		 * <p> In here, tournament selection is used. #tournament children are drawn randomly and the one 
+		 * with the best rank wins. Ranks must be computed by GAPopulation::rank() before. </p>
+		 *
+		 *	\li Referenced Wikipedia: https://en.wikipedia.org/wiki/Tournament_selection
+		 *
 		 * @param population The target of tournament
-		 * @return The best genes derived by the tournament
+		 * @param engine A random engine
+		 *
+		 * @return Index of the best genes derived by the tournament
 		 */
-		auto selection(std::shared_ptr<Population> population) const -> std::shared_ptr<GeneArray>
+		auto selection(const Population &population, Engine &engine) const -> size_t
 		{
-			size_t size = population->children.size();
-			Population tornament(size);
+			size_t size = population.children.size();
+			size_t best = size;
 
-			for (size_t i = 0; i < size; i++)
+			for (size_t i = 0; i < std::max<size_t>(tournament, 1); i++)
 			{
-				size_t randomIndex = (size_t)(Math::random() * size);
+				size_t randomIndex = (size_t)(random(engine) * size);
 				if (randomIndex == size)
 					randomIndex--;
 
-				tornament.children[i] = population->children[randomIndex];
+				if (best == size || population.ranks[randomIndex] < population.ranks[best])
+					best = randomIndex;
 			}
-			return tornament.fitTest();
+			return best;
 		};
 
+	protected:
 		/**
 		 * @brief Create a new GeneArray by crossing over two GeneArray(s)
 		 *
@@ -213,10 +484,14 @@ namespace library
 		 *
 		 *	\li Referenced Wikipedia: https://en.wikipedia.org/wiki/Crossover_(genetic_algorithm)
 		 *
+		 * <p> Genes are taken from either of the parents uniformly; a derived class can override the operator 
+		 * for its own representation of genes. </p>
+		 *
 		 * @param parent1 A parent sequence listing
 		 * @param parent2 A parent sequence listing
+		 * @param engine A random engine
 		 */
-		auto crossover(std::shared_ptr<GeneArray> &parent1, std::shared_ptr<GeneArray> &parent2) const -> std::shared_ptr<GeneArray>
+		virtual auto crossover(const std::shared_ptr<GeneArray> &parent1, const std::shared_ptr<GeneArray> &parent2, Engine &engine) const -> std::shared_ptr<GeneArray>
 		{
 			std::shared_ptr<GeneArray> individual(new GeneArray(*parent1));
 			size_t size = parent1->size();
@@ -224,17 +499,17 @@ namespace library
 			if (unique == false)
 			{
 				for (size_t i = 0; i < size; i++)
-					if (Math::random() > .5)
+					if (random(engine) > .5)
 						individual->at(i) = parent2->at(i);
 			}
 			else
 			{
-				std::set<GeneArray::value_type> ptrSet;
+				std::set<typename GeneArray::value_type> ptrSet;
 				std::set<size_t> indexSet;
 
 				// RANGES
-				size_t start = (size_t)(Math::random() * size);
-				size_t end = (size_t)(Math::random() * size);
+				size_t start = (size_t)(random(engine) * size);
+				size_t end = (size_t)(random(engine) * size);
 
 				if (start > end)
 					std::swap(start, end);
@@ -249,7 +524,7 @@ namespace library
 				//INSERT PARENT_2
 				for (size_t i = 0; i < size; i++)
 				{
-					GeneArray::value_type &ptr = parent2->at(i);
+					typename GeneArray::value_type &ptr = parent2->at(i);
 					if (ptrSet.find(ptr) != ptrSet.end())
 						continue;
 
@@ -260,7 +535,22 @@ namespace library
 			return individual;
 		};
 
-	protected:
+		/**
+		 * @brief Diversify an individual of the initial population
+		 *
+		 * @details
+		 * <p> Individuals of an initial population except the first, kept for eliticism, are copies of the
+		 * initial set of genes diversified by this method. It shuffles the genes by default; a derived class
+		 * can override it for its own representation of genes. </p>
+		 *
+		 * @param individual A copy of the initial set of genes
+		 * @param engine A random engine of the population
+		 */
+		virtual void diversify(std::shared_ptr<GeneArray> individual, Engine &engine) const
+		{
+			std::shuffle(individual->begin(), individual->end(), engine);
+		};
+
 		/**
 		 * @brief Cause a mutation on the GeneArray
 		 *
@@ -289,20 +579,65 @@ namespace library
 		 * <p> Genes in the GeneArray will be swapped following percentage of the mutationRate. </p>
 		 *
 		 * @param individual A container of genes to mutate
+		 * @param engine A random engine
 		 * @see mutationRate;
 		 */
-		virtual void mutate(std::shared_ptr<GeneArray> individual) const
+		virtual void mutate(std::shared_ptr<GeneArray> individual, Engine &engine) const
 		{
 			for (size_t i = 0; i < individual->size(); i++)
 			{
-				if (Math::random() > mutationRate)
+				if (random(engine) > mutationRate)
 					continue;
 
 				// JUST SHUFFLE SEQUENCE OF GENES
-				size_t j = (size_t)(Math::random() * individual->size());
+				size_t j = (size_t)(random(engine) * individual->size());
+				if (j == individual->size())
+					j--;
+
 				std::swap(individual->at(i), individual->at(j));
 			}
 		};
+
+		/**
+		 * @brief Evaluate fitness of a GeneArray
+		 *
+		 * @details
+		 * <p> A hook called in parallel, once for each GeneArray. The returned scalar fitness is stored in
+		 * the population, so that selection and elitism compare fitness values only, without comparing
+		 * GeneArray objects by Compare. The lower fitness, the better GeneArray. </p>
+		 *
+		 * <p> Default implementation returns <i>NaN</i>, which means the GeneArray cannot be scored by a
+		 * scalar. In that case, GeneArray objects are compared by Compare. </p>
+		 *
+		 * @param individual A GeneArray to evaluate
+		 * @return Fitness of the GeneArray
+		 */
+		virtual auto evaluate(std::shared_ptr<GeneArray> /*individual*/) const -> double
+		{
+			return std::numeric_limits<double>::quiet_NaN();
+		};
+
+		/**
+		 * @brief Create a random engine for a child of a generation
+		 *
+		 * @param island Index of the island
+		 * @param generation Sequence number of the generation
+		 * @param index Index of the child in the generation
+		 */
+		auto createEngine(size_t island, size_t generation, size_t index) const -> Engine
+		{
+			return Engine({ seed, island, generation, index });
+		};
+
+		/**
+		 * @brief Get a random number in [0, 1)
+		 *
+		 * @param engine A random engine
+		 */
+		static auto random(Engine &engine) -> double
+		{
+			return engine.random();
+		};
 	};
 };
 };
\ No newline at end of file
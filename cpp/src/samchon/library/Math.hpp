@@ -4,6 +4,7 @@
 #include <random>
 #include <map>
 #include <samchon/IndexPair.hpp>
+#include <samchon/library/Random.hpp>
 
 namespace samchon
 {
@@ -129,15 +130,20 @@ namespace library
 		/**
 		 * @brief Get a random value
 		 *
-		 * @details Returns a random value following uniform distribution
+		 * @details
+		 * <p> Returns a random value following uniform distribution, in [0, 1). </p>
+		 *
+		 * <p> Each thread has its own Random engine, seeded once by std::random_device. Thus the method
+		 * is thread-safe, but not reproducible. For reproducible random values, use a Random engine with 
+		 * explicit seed. </p>
+		 *
 		 * @return The random value
 		 */
 		static auto random() -> double
 		{
-			static std::random_device device;
-			static std::uniform_real_distribution<double> distribution(0.0, 1.0);
+			thread_local Random engine(std::random_device{}());
 
-			return distribution(device);
+			return engine.random();
 		};
 
 		/* ========================================================
@@ -173,7 +179,7 @@ namespace library
 		 * @param container Container to find its minimum value
 		 * @return Pair of minimum value and its index
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto minimum(const _Cont &container) -> IndexPair<T>
 		{
 			auto it = container.begin();
@@ -204,7 +210,7 @@ namespace library
 		 * @param container Container to find its minimum value
 		 * @return Pair of maximum value and its index
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto maximum(const _Cont &container) -> IndexPair<T>
 		{
 			auto it = container.begin();
@@ -233,9 +239,9 @@ namespace library
 		 *	<p> Do not modify the default template argument. </p>
 		 *
 		 * @param container Container to find its mean
-		 * @return Average(mean) of the contaier
+		 * @return Average(mean) of the container
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto mean(const _Cont &container) -> double
 		{
 			double val = 0.0;
@@ -256,7 +262,7 @@ namespace library
 		 * @param container Container to find its median
 		 * @return Median value of the container
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto median(const _Cont &container) -> double
 		{
 			auto it = container.begin();
@@ -288,7 +294,7 @@ namespace library
 		 * @param container Container to find its mode
 		 * @return Most appeared value in the container
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto mode(const _Cont &container) -> T
 		{
 			std::map<T, size_t> frequencyMap;
@@ -312,10 +318,10 @@ namespace library
 		 * <p> \f$\sqrt{(x_2-x_1)^2+(y_2-y_1)^2}\f$ </p>
 		 * @copydetails variance_p()
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto stdev_p(const _Cont &container) -> double
 		{
-			return sqrt(variance_p(contaier));
+			return sqrt(variance_p(container));
 		};
 
 		/**
@@ -323,7 +329,7 @@ namespace library
 		 *
 		 * @copydetails variance_s()
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto stdev_s(const _Cont &container) -> double
 		{
 			return sql(variance_s(container));
@@ -340,7 +346,7 @@ namespace library
 		 * @param container Container to find its standard deviation
 		 * @return Standard deviation of the container
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto variance_p(const _Cont &container) -> double
 		{
 			double val = 0.0;
@@ -363,7 +369,7 @@ namespace library
 		 * @param container Container to find its variance
 		 * @return Variance of the container
 		 */
-		template <typename _Cont, typename T = _Cont::value_type>
+		template <typename _Cont, typename T = typename _Cont::value_type>
 		static auto variance_s(const _Cont &container) -> double
 		{
 			double val = 0.0;
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <initializer_list>
+
+namespace samchon
+{
+namespace library
+{
+	/**
+	 * @brief A random number engine
+	 *
+	 * @details
+	 * <p> Random is a xoshiro256** generator; a small (256 bits of state), fast and statistically robust
+	 * pseudo random number generator. It satisfies requirements of <i>UniformRandomBitGenerator</i>, so
+	 * that it can be used with distributions and algorithms of STL like std::shuffle. </p>
+	 *
+	 * <p> Random is not thread-safe. Give each thread (or each task) its own engine. An engine constructed
+	 * from the same seed values generates the same sequence, in any platform. </p>
+	 *
+	 *	\li Referenced: http://xoshiro.di.unimi.it/
+	 *
+	 * @author Jeongho Nam <http://samchon.org>
+	 */
+	class Random
+	{
+	public:
+		typedef uint64_t result_type;
+
+	private:
+		/**
+		 * @brief State of the generator
+		 */
+		uint64_t state[4];
+
+	public:
+		/* ========================================================
+			CONSTRUCTORS
+		======================================================== */
+		/**
+		 * @brief Construct from a seed
+		 *
+		 * @param seed Seed value
+		 */
+		Random(uint64_t seed = 0)
+		{
+			construct(&seed, &seed + 1);
+		};
+
+		/**
+		 * @brief Construct from seed values
+		 *
+		 * @details
+		 * <p> Seed values are mixed by splitmix64, in order. Thus engines seeded by (seed, stream) pairs
+		 * differing only in the stream are independent each other. </p>
+		 *
+		 * @param seeds Seed values
+		 */
+		Random(std::initializer_list<uint64_t> seeds)
+		{
+			construct(seeds.begin(), seeds.end());
+		};
+
+		/* ========================================================
+			GENERATORS
+		======================================================== */
+		static constexpr auto min() -> result_type
+		{
+			return 0;
+		};
+		static constexpr auto max() -> result_type
+		{
+			return std::numeric_limits<uint64_t>::max();
+		};
+
+		/**
+		 * @brief Generate a random integer
+		 */
+		auto operator()() -> result_type
+		{
+			uint64_t result = rotate(state[1] * 5, 7) * 9;
+			uint64_t t = state[1] << 17;
+
+			state[2] ^= state[0];
+			state[3] ^= state[1];
+			state[1] ^= state[2];
+			state[0] ^= state[3];
+
+			state[2] ^= t;
+			state[3] = rotate(state[3], 45);
+
+			return result;
+		};
+
+		/**
+		 * @brief Generate a random value in [0, 1)
+		 *
+		 * @details Takes upper 53 bits of a random integer, so that the value follows uniform distribution.
+		 */
+		auto random() -> double
+		{
+			return (operator()() >> 11) * (1.0 / 9007199254740992.0);
+		};
+
+		/* ========================================================
+			STATE
+		======================================================== */
+		/**
+		 * @brief Get state of the generator
+		 */
+		auto getState() const -> std::array<uint64_t, 4>
+		{
+			return { state[0], state[1], state[2], state[3] };
+		};
+
+		/**
+		 * @brief Set state of the generator
+		 *
+		 * @details The state must not be all zeros.
+		 *
+		 * @param val State to generate from, in order of the reference implementation.
+		 */
+		void setState(const std::array<uint64_t, 4> &val)
+		{
+			for (size_t i = 0; i < 4; i++)
+				state[i] = val[i];
+		};
+
+	private:
+		void construct(const uint64_t *first, const uint64_t *last)
+		{
+			uint64_t x = 0x9e3779b97f4a7c15ULL;
+			for (const uint64_t *it = first; it != last; it++)
+				x = splitmix(x ^ *it);
+
+			for (size_t i = 0; i < 4; i++)
+				state[i] = x = splitmix(x);
+		};
+
+		static auto rotate(uint64_t x, int k) -> uint64_t
+		{
+			return (x << k) | (x >> (64 - k));
+		};
+
+		static auto splitmix(uint64_t x) -> uint64_t
+		{
+			uint64_t z = x + 0x9e3779b97f4a7c15ULL;
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+			return z ^ (z >> 31);
+		};
+	};
+};
+};
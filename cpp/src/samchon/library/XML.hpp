@@ -255,7 +255,7 @@ namespace library
 				return;
 
 			//<comp label='ABCD' /> : " label='ABCD' "
-			WeakString &line = wstr.substring(i_begin, i_end); 
+			WeakString line = wstr.substring(i_begin, i_end); 
 
 			if (line.find('=') == std::string::npos)
 				return;
@@ -386,7 +386,8 @@ namespace library
 					/*xml = new XML(this, wstr.substring(start, end + 1));
 					xmlQueueMap[xml->tag].push(xml);*/
 
-					std::shared_ptr<XML> xml(new XML(this, wstr.substring(start, end + 1)));
+					WeakString piece = wstr.substring(start, end + 1);
+					std::shared_ptr<XML> xml(new XML(this, piece));
 					push_back(xml);
 
 					i = end; //WHY NOT END+1? 
@@ -494,23 +495,7 @@ namespace library
 		 */
 		template<class T = std::string> auto getValue() const -> T
 		{
-			double val = std::stod(value_);
-
-			return (T)val;
-		};
-
-		template<> auto getValue() const -> bool
-		{
-			return value_ == "true";
-		};
-
-		template<> auto getValue() const -> std::string
-		{
-			return value_;
-		};
-		template<> auto getValue() const -> WeakString
-		{
-			return value_;
+			return parse(value_, (T*)nullptr);
 		};
 
 		/* -------------------------------------------------------------
@@ -536,23 +521,7 @@ namespace library
 		 */
 		template<class T = std::string> auto getProperty(const std::string &key) const -> T
 		{
-			double val = std::stod(property_map_.get(key));
-
-			return (T)val;
-		};
-
-		template<> auto getProperty(const std::string &key) const -> bool
-		{
-			return property_map_.get(key) == "true";
-		};
-
-		template<> auto getProperty(const std::string &key) const -> std::string
-		{
-			return property_map_.get(key);
-		};
-		template<> auto getProperty(const std::string &key) const -> WeakString
-		{
-			return property_map_.get(key);
+			return parse(property_map_.get(key), (T*)nullptr);
 		};
 
 		/**
@@ -635,16 +604,16 @@ namespace library
 			value_ = std::to_string(val);
 		};
 
-		template<> void setValue(const bool &flag)
+		void setValue(const bool &flag)
 		{
 			this->value_ = flag ? "true" : "false";
 		};
 
-		template<> void setValue(const std::string &val)
+		void setValue(const std::string &val)
 		{
 			this->value_ = val;
 		};
-		template<> void setValue(const WeakString &val)
+		void setValue(const WeakString &val)
 		{
 			this->value_ = val.str();
 		};
@@ -682,16 +651,16 @@ namespace library
 			property_map_.set(key, std::to_string(val));
 		};
 
-		template<> void setProperty(const std::string &key, const bool &flag)
+		void setProperty(const std::string &key, const bool &flag)
 		{
 			property_map_.set(key, flag ? "true" : "false");
 		};
 
-		template<> void setProperty(const std::string &key, const std::string &val)
+		void setProperty(const std::string &key, const std::string &val)
 		{
 			property_map_.set(key, val);
 		};
-		template<> void setProperty(const std::string &key, const WeakString &val)
+		void setProperty(const std::string &key, const WeakString &val)
 		{
 			property_map_.set(key, val.str());
 		};
@@ -823,6 +792,31 @@ namespace library
 		/* -----------------------------------------------------------
 			FILTERS
 		----------------------------------------------------------- */
+		/**
+		 * @brief Parse a value or a property, by type of the pointer.
+		 *
+		 * @details Overloads, instead of explicit specializations in the class scope which are not standard.
+		 */
+		template <typename T>
+		static auto parse(const std::string &str, T*) -> T
+		{
+			double val = std::stod(str);
+
+			return (T)val;
+		};
+		static auto parse(const std::string &str, bool*) -> bool
+		{
+			return str == "true";
+		};
+		static auto parse(const std::string &str, std::string*) -> std::string
+		{
+			return str;
+		};
+		static auto parse(const std::string &str, WeakString*) -> WeakString
+		{
+			return str;
+		};
+
 		auto calc_min_index(const std::vector<size_t> &vec) const -> size_t
 		{
 			size_t val = std::string::npos;
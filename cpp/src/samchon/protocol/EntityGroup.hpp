@@ -70,28 +70,28 @@ namespace protocol
 		 */
 		virtual void construct(std::shared_ptr<library::XML> xml)
 		{
-			clear();
-			if (xml->has(CHILD_TAG()) == false)
+			this->clear();
+			if (xml->has(this->CHILD_TAG()) == false)
 				return;
 
-			std::shared_ptr<library::XMLList> &xml_list = xml->get(CHILD_TAG());
+			std::shared_ptr<library::XMLList> &xml_list = xml->get(this->CHILD_TAG());
 
-			if (std::is_same<container_type, std::vector<container_type::value_type, container_type::allocator_type>>::value == true)
+			if (std::is_same<container_type, std::vector<typename container_type::value_type, typename container_type::allocator_type>>::value == true)
 			{
 				//FOR RESERVE
-				assign(xml_list->size(), nullptr);
-				erase(begin(), end());
+				this->assign(xml_list->size(), nullptr);
+				this->erase(this->begin(), this->end());
 			}
 
 			for (size_t i = 0; i < xml_list->size(); i++)
 			{
 				std::shared_ptr<library::XML> &xmlElement = xml_list->at(i);
 
-				child_type *entity = createChild(xmlElement);
+				child_type *entity = this->createChild(xmlElement);
 				if (entity != nullptr)
 				{
 					entity->construct(xml_list->at(i));
-					emplace_back(entity);
+					this->emplace_back(entity);
 				}
 			}
 		};
@@ -117,9 +117,9 @@ namespace protocol
 
 		void erase(const typename child_type::key_type &key)
 		{
-			for (auto it = begin(); it != end(); )
+			for (auto it = this->begin(); it != this->end(); )
 				if ((*it)->key() == key)
-					it = erase(it);
+					it = this->erase(it);
 				else
 					it++;
 		};
@@ -145,8 +145,8 @@ namespace protocol
 		{
 			return std::find_if
 			(
-				begin(), end(),
-				[key](const container_type::value_type &entity) -> bool
+				this->begin(), this->end(),
+				[key](const typename container_type::value_type &entity) -> bool
 				{
 					return entity->key() == key;
 				}
@@ -174,8 +174,8 @@ namespace protocol
 		{
 			return std::find_if
 			(
-				begin(), end(),
-				[key](const container_type::value_type &entity) -> bool
+				this->begin(), this->end(),
+				[key](const typename container_type::value_type &entity) -> bool
 				{
 					return entity->key() == key;
 				}
@@ -192,8 +192,8 @@ namespace protocol
 		{
 			return std::any_of
 			(
-				begin(), end(),
-				[key](const container_type::value_type &entity) -> bool
+				this->begin(), this->end(),
+				[key](const typename container_type::value_type &entity) -> bool
 				{
 					return entity->key() == key;
 				}
@@ -210,8 +210,8 @@ namespace protocol
 		{
 			return std::count_if
 			(
-				begin(), end(),
-				[key](const container_type::value_type &entity) -> bool
+				this->begin(), this->end(),
+				[key](const typename container_type::value_type &entity) -> bool
 				{
 					return entity->key() == key;
 				}
@@ -228,14 +228,14 @@ namespace protocol
 		{
 			auto it = std::find_if
 				(
-					begin(), end(),
-					[key](const container_type::value_type &entity) -> bool
+					this->begin(), this->end(),
+					[key](const typename container_type::value_type &entity) -> bool
 					{
 						return entity->key() == key;
 					}
 				);
 
-			if (it == end())
+			if (it == this->end())
 				throw std::out_of_range("out of range");
 
 			return *it;
@@ -251,14 +251,14 @@ namespace protocol
 		{
 			auto it = std::find_if
 				(
-					begin(), end(),
-					[key](const container_type::value_type &entity) -> bool
+					this->begin(), this->end(),
+					[key](const typename container_type::value_type &entity) -> bool
 					{
 						return entity->key() == key;
 					}
 				);
 
-			if (it == end())
+			if (it == this->end())
 				throw std::out_of_range("out of range");
 
 			return *it;
@@ -284,15 +284,15 @@ namespace protocol
 		 */
 		virtual auto toXML() const -> std::shared_ptr<library::XML>
 		{
-			std::shared_ptr<library::XML> &xml = Entity::toXML();
+			std::shared_ptr<library::XML> xml = Entity<Key>::toXML();
 
 			std::shared_ptr<library::XMLList> xmlList(new library::XMLList());
 			xmlList->reserve(this->size());
 
-			for (auto it = begin(); it != end(); it++)
+			for (auto it = this->begin(); it != this->end(); it++)
 				xmlList->push_back((*it)->toXML());
 
-			xml->set(CHILD_TAG(), xmlList);
+			xml->set(this->CHILD_TAG(), xmlList);
 			return xml;
 		};
 	};
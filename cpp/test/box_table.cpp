@@ -0,0 +1,97 @@
+#include <boxologic/BoxTable.hpp>
+
+#include <random>
+#include <test.hpp>
+
+using namespace std;
+using namespace boxologic;
+
+static auto same(const BoxFit &x, const BoxFit &y) -> bool
+{
+	return x.index == y.index
+		&& x.x == y.x && x.y == y.y && x.z == y.z
+		&& x.fx == y.fx && x.fy == y.fy && x.fz == y.fz;
+};
+
+int main()
+{
+	mt19937 engine(2017);
+	size_t comparisons = 0;
+
+	for (size_t trial = 0; trial < 200; trial++)
+	{
+		// BOXES OF SOME TYPES; INTEGRAL OR FRACTIONAL, INCLUDING CUBES
+		bool fractional = (trial % 2 == 1);
+		size_t types = 1 + engine() % 40;
+
+		vector<Box> boxes;
+		for (size_t t = 0; t < types; t++)
+		{
+			Box box = {};
+			box.width = 1 + engine() % 20;
+			box.height = (engine() % 4 == 0) ? box.width : 1 + engine() % 20;
+			box.length = (engine() % 4 == 0) ? box.width : 1 + engine() % 20;
+
+			if (fractional == true)
+			{
+				box.width += (engine() % 100) / 100.0;
+				box.length += (engine() % 100) / 100.0;
+			}
+
+			size_t count = 1 + engine() % 5;
+			for (size_t i = 0; i < count; i++)
+				boxes.push_back(box);
+		}
+		shuffle(boxes.begin(), boxes.end(), engine);
+
+		BoxTable table;
+		table.assign(boxes);
+
+		// PACK SOME BOXES, SO THAT SOME TYPES ARE EXHAUSTED
+		while (engine() % 3 != 0)
+		{
+			const vector<BoxType> &boxTypes = table.get_types();
+			const BoxType &type = boxTypes[engine() % boxTypes.size()];
+
+			if (type.remaining != 0)
+				table.pack(type.front());
+		}
+
+		// RANDOM GAPS
+		for (size_t i = 0; i < 100; i++)
+		{
+			double hmx = engine() % 30;
+			double hy = engine() % 25;
+			double hmy = hy + engine() % 10;
+			double hz = engine() % 25;
+			double hmz = hz + engine() % 10;
+
+			BoxFit within_scalar = { (size_t)-1, 0, 0, 0, INT_MAX, INT_MAX, INT_MAX };
+			BoxFit beyond_scalar = within_scalar;
+			BoxFit within_avx2 = within_scalar;
+			BoxFit beyond_avx2 = within_scalar;
+
+			table.find_scalar(hmx, hy, hmy, hz, hmz, within_scalar, beyond_scalar);
+#ifdef BOXOLOGIC_AVX2
+			if (BoxTable::supports_avx2() == true)
+				table.find_avx2(hmx, hy, hmy, hz, hmz, within_avx2, beyond_avx2);
+			else
+#endif
+				table.find_scalar(hmx, hy, hmy, hz, hmz, within_avx2, beyond_avx2);
+
+			CHECK(same(within_scalar, within_avx2));
+			CHECK(same(beyond_scalar, beyond_avx2));
+
+			// AND THE DISPATCHER
+			BoxFit within, beyond;
+			table.find(hmx, hy, hmy, hz, hmz, within, beyond);
+
+			CHECK(same(within_scalar, within));
+			CHECK(same(beyond_scalar, beyond));
+			comparisons++;
+		}
+	}
+	printf("%d comparisons, %s\n", (int)comparisons, BoxTable::supports_avx2() ? "AVX2 against scalar" : "AVX2 is not supported");
+
+	return test::report();
+}
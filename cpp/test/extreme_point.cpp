@@ -0,0 +1,98 @@
+#include <bws/packer/ExtremePoint.hpp>
+#include <bws/packer/Product.hpp>
+
+#include <random>
+#include <test.hpp>
+
+using namespace std;
+using namespace bws::packer;
+
+static const double EPSILON = 1e-6;
+
+/**
+ * @brief Test whether two wraps share a volume.
+ */
+static auto overlaps(const Wrap &a, const Wrap &b) -> bool
+{
+	return a.getX() < b.getX() + b.getLayoutWidth() - EPSILON && b.getX() < a.getX() + a.getLayoutWidth() - EPSILON
+		&& a.getY() < b.getY() + b.getLayoutHeight() - EPSILON && b.getY() < a.getY() + a.getLayoutHeight() - EPSILON
+		&& a.getZ() < b.getZ() + b.getLayoutLength() - EPSILON && b.getZ() < a.getZ() + a.getLayoutLength() - EPSILON;
+};
+
+/**
+ * @brief Test whether a wrap is within the containable space of its wrapper.
+ */
+static auto within(const Wrapper &wrapper, const Wrap &wrap) -> bool
+{
+	double thickness = wrapper.getThickness();
+
+	return wrap.getX() >= thickness - EPSILON
+		&& wrap.getY() >= thickness - EPSILON
+		&& wrap.getZ() >= thickness - EPSILON
+		&& wrap.getX() + wrap.getLayoutWidth() <= thickness + wrapper.getContainableWidth() + EPSILON
+		&& wrap.getY() + wrap.getLayoutHeight() <= thickness + wrapper.getContainableHeight() + EPSILON
+		&& wrap.getZ() + wrap.getLayoutLength() <= thickness + wrapper.getContainableLength() + EPSILON;
+};
+
+int main()
+{
+	mt19937 engine(2017);
+	size_t packed = 0;
+
+	// AN ENGINE IS REUSED, LIKE THE THREAD-LOCAL ONE OF WRAPPER_GROUP
+	ExtremePoint extremePoint;
+
+	for (size_t trial = 0; trial < 200; trial++)
+	{
+		// SOME SKUS; INTEGRAL OR FRACTIONAL
+		bool fractional = (trial % 3 == 2);
+		size_t skus = 1 + engine() % 15;
+
+		vector<shared_ptr<Instance>> products;
+		for (size_t i = 0; i < skus; i++)
+		{
+			double width = 1 + engine() % 30;
+			double height = 1 + engine() % 30;
+			double length = 1 + engine() % 30;
+
+			if (fractional == true)
+			{
+				width += (engine() % 10) / 10.0;
+				length += (engine() % 10) / 10.0;
+			}
+			products.emplace_back(new Product("P" + to_string(i), width, height, length));
+		}
+
+		shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+		size_t count = 1 + engine() % 400;
+
+		for (size_t i = 0; i < count; i++)
+			instanceArray->push_back(products[engine() % skus]);
+
+		shared_ptr<Wrapper> wrapper(new Wrapper
+		(
+			"Wrapper", 1000,
+			20 + engine() % 150, 20 + engine() % 150, 20 + engine() % 150,
+			(double)(engine() % 3)
+		));
+
+		auto result = extremePoint.pack(wrapper, instanceArray);
+		const Wrapper &myWrapper = *result.first;
+
+		// ALL INSTANCES ARE ACCOUNTED FOR; PACKED OR LEFT
+		CHECK(myWrapper.size() + result.second->size() == instanceArray->size());
+		packed += myWrapper.size();
+
+		// EVERY WRAP IS WITHIN THE WRAPPER, WITHOUT OVERLAPPING ANOTHER
+		for (size_t i = 0; i < myWrapper.size(); i++)
+		{
+			CHECK(within(myWrapper, *myWrapper.at(i)));
+
+			for (size_t j = 0; j < i; j++)
+				CHECK(overlaps(*myWrapper.at(i), *myWrapper.at(j)) == false);
+		}
+	}
+
+	printf("%d instances packed\n", (int)packed);
+	return test::report();
+};
@@ -0,0 +1,145 @@
+#include <bws/packer/FixedPoint.hpp>
+#include <bws/packer/Packer.hpp>
+
+#include <cmath>
+#include <stdexcept>
+#include <test.hpp>
+
+using namespace std;
+using namespace bws::packer;
+
+static const double EPSILON = 1e-6;
+
+int main()
+{
+	// WRAPPERS OF A SAME NAME, DIFFERENT IN DIMENSIONS
+	shared_ptr<WrapperArray> wrapperArray(new WrapperArray());
+	wrapperArray->emplace_back(new Wrapper("Box", 1000, 40.05, 30.0, 50.19, 0.51));
+	wrapperArray->emplace_back(new Wrapper("Box", 1000, 20.3, 30.0, 25.11, 0.5));
+
+	shared_ptr<Instance> a(new Product("A", 10.01, 9.99, 10.0));
+	shared_ptr<Instance> b(new Product("B", 4.55, 5.0, 3.333));
+
+	shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+	instanceArray->assign(6, a);
+	instanceArray->insert(instanceArray->end(), 4, b);
+
+	// INVALID PRECISIONS
+	for (double precision : { 0.0, -0.1, (double)INFINITY, (double)NAN })
+	{
+		bool thrown = false;
+		try
+		{
+			FixedPoint fixedPoint(precision, wrapperArray, instanceArray);
+		}
+		catch (invalid_argument &)
+		{
+			thrown = true;
+		}
+		CHECK(thrown);
+	}
+
+	FixedPoint fixedPoint(0.1, wrapperArray, instanceArray);
+
+	// CONSERVATIVE ROUNDING; WRAPPERS DOWN, THEIR THICKNESS AND INSTANCES UP
+	const WrapperArray &wrappers = *fixedPoint.getWrapperArray();
+	CHECK(wrappers.size() == 2);
+
+	CHECK(wrappers.at(0)->getName() == "Box" && wrappers.at(1)->getName() == "Box");
+	CHECK(wrappers.at(0)->getWidth() == 400 && wrappers.at(0)->getHeight() == 300 && wrappers.at(0)->getLength() == 501);
+	CHECK(wrappers.at(0)->getThickness() == 6);
+	CHECK(wrappers.at(1)->getWidth() == 203 && wrappers.at(1)->getHeight() == 300 && wrappers.at(1)->getLength() == 251);
+	CHECK(wrappers.at(1)->getThickness() == 5); // EXACT ONE IS NOT ROUNDED
+
+	for (size_t i = 0; i < wrappers.size(); i++)
+		CHECK(wrappers.at(i)->getContainableWidth() * 0.1 <= wrapperArray->at(i)->getContainableWidth() + EPSILON
+			&& wrappers.at(i)->getContainableHeight() * 0.1 <= wrapperArray->at(i)->getContainableHeight() + EPSILON
+			&& wrappers.at(i)->getContainableLength() * 0.1 <= wrapperArray->at(i)->getContainableLength() + EPSILON);
+
+	const InstanceArray &instances = *fixedPoint.getInstanceArray();
+	CHECK(instances.size() == instanceArray->size());
+	CHECK(instances.at(0)->getWidth() == 101 && instances.at(0)->getHeight() == 100 && instances.at(0)->getLength() == 100);
+	CHECK(instances.at(6)->getWidth() == 46 && instances.at(6)->getHeight() == 50 && instances.at(6)->getLength() == 34);
+
+	// A DISTINCT INSTANCE IS ENCODED ONCE
+	CHECK(instances.at(0) == instances.at(5));
+	CHECK(instances.at(6) == instances.at(9));
+	CHECK(instances.at(0) != instances.at(6));
+
+	// DECODED TO THE CALLER'S OBJECTS; EACH WRAPPER TO ITS OWN, ALTHOUGH OF A SAME NAME
+	{
+		shared_ptr<WrapperArray> packed(new WrapperArray());
+		for (size_t i = 0; i < wrappers.size(); i++)
+		{
+			shared_ptr<Wrapper> wrapper(new Wrapper(*wrappers.at(i)));
+			wrapper->emplace_back(new Wrap(wrapper.get(), instances.at(0), 6, 6, 6, 1));
+			wrapper->emplace_back(new Wrap(wrapper.get(), instances.at(6), 107, 6, 6, 2));
+
+			packed->push_back(wrapper);
+		}
+
+		shared_ptr<WrapperArray> decoded = fixedPoint.decode(packed);
+		CHECK(decoded->size() == 2);
+
+		for (size_t i = 0; i < decoded->size(); i++)
+		{
+			const Wrapper &wrapper = *decoded->at(i);
+
+			CHECK(wrapper == *wrapperArray->at(i));
+			CHECK(wrapper.size() == 2);
+			CHECK(wrapper.at(0)->getInstance() == a);
+			CHECK(wrapper.at(1)->getInstance() == b);
+			CHECK(fabs(wrapper.at(1)->getX() - 10.7) < EPSILON && fabs(wrapper.at(1)->getY() - .6) < EPSILON);
+			CHECK(wrapper.at(1)->getOrientation() == 2);
+		}
+
+		// A WRAPPER NOT ENCODED BY THE FIXED POINT
+		packed->front().reset(new Wrapper("Box", 1000, 401, 300, 501, 6));
+
+		bool thrown = false;
+		try
+		{
+			fixedPoint.decode(packed);
+		}
+		catch (out_of_range &)
+		{
+			thrown = true;
+		}
+		CHECK(thrown);
+	}
+
+	// THROUGH THE PACKER; THE CALLER'S OBJECTS, WITHIN THE CALLER'S WRAPPERS
+	{
+		Packer packer(wrapperArray, instanceArray);
+		packer.setPrecision(0.1);
+
+		samchon::library::GAParameters gaParams(4, 10, 2, .2);
+		gaParams.setSeed(2017);
+
+		shared_ptr<WrapperArray> result = packer.optimize(gaParams);
+		size_t packed = 0;
+
+		for (size_t i = 0; i < result->size(); i++)
+		{
+			const Wrapper &wrapper = *result->at(i);
+			CHECK(wrapper == *wrapperArray->at(0) || wrapper == *wrapperArray->at(1));
+
+			for (size_t j = 0; j < wrapper.size(); j++)
+			{
+				const Wrap &wrap = *wrapper.at(j);
+				CHECK(wrap.getInstance() == a || wrap.getInstance() == b);
+
+				CHECK(wrap.getX() >= wrapper.getThickness() - EPSILON
+					&& wrap.getY() >= wrapper.getThickness() - EPSILON
+					&& wrap.getZ() >= wrapper.getThickness() - EPSILON);
+				CHECK(wrap.getX() + wrap.getLayoutWidth() <= wrapper.getThickness() + wrapper.getContainableWidth() + EPSILON
+					&& wrap.getY() + wrap.getLayoutHeight() <= wrapper.getThickness() + wrapper.getContainableHeight() + EPSILON
+					&& wrap.getZ() + wrap.getLayoutLength() <= wrapper.getThickness() + wrapper.getContainableLength() + EPSILON);
+			}
+			packed += wrapper.size();
+		}
+		CHECK(packed == instanceArray->size());
+	}
+
+	return test::report();
+};
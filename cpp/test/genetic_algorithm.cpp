@@ -0,0 +1,99 @@
+#include <bws/packer/Packer.hpp>
+#include <bws/packer/Product.hpp>
+
+#include <random>
+#include <string>
+#include <test.hpp>
+
+using namespace std;
+using namespace bws::packer;
+
+/**
+ * @brief Digest of a solution; types, positions and orientations of the wraps.
+ */
+static auto digest(shared_ptr<WrapperArray> wrapperArray) -> string
+{
+	string str;
+	for (size_t i = 0; i < wrapperArray->size(); i++)
+	{
+		shared_ptr<Wrapper> wrapper = wrapperArray->at(i);
+		str += wrapper->getName() + "{";
+
+		for (size_t j = 0; j < wrapper->size(); j++)
+		{
+			shared_ptr<Wrap> wrap = wrapper->at(j);
+			str += wrap->getInstance()->getName() + "@"
+				+ to_string(wrap->getX()) + "," + to_string(wrap->getY()) + "," + to_string(wrap->getZ())
+				+ "#" + to_string(wrap->getOrientation()) + ";";
+		}
+		str += "}";
+	}
+	return str;
+};
+
+static auto optimize(shared_ptr<WrapperArray> wrapperArray, shared_ptr<InstanceArray> instanceArray, bool countGenes, size_t islands, size_t threads) -> string
+{
+	Packer packer(wrapperArray, instanceArray);
+	packer.setCountGenes(countGenes);
+
+	samchon::library::GAParameters gaParams(6, 20, 4, .2);
+	gaParams.setSeed(2017);
+	gaParams.setThreads(threads);
+	gaParams.setIslands(islands);
+	gaParams.setMigrationInterval(2);
+
+	return digest(packer.optimize(gaParams));
+};
+
+int main()
+{
+	// AN ORDER OF SEVERAL SKUS
+	shared_ptr<WrapperArray> wrapperArray(new WrapperArray());
+	wrapperArray->emplace_back(new Wrapper("Large", 1000, 100, 80, 120, 0));
+	wrapperArray->emplace_back(new Wrapper("Medium", 600, 70, 60, 80, 1));
+	wrapperArray->emplace_back(new Wrapper("Small", 300, 50, 40, 50, 0));
+
+	shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+	mt19937 engine(1234);
+
+	for (size_t i = 0; i < 10; i++)
+	{
+		shared_ptr<Instance> product(new Product("P" + to_string(i), 5 + engine() % 30, 5 + engine() % 30, 5 + engine() % 30));
+		size_t count = 1 + engine() % 12;
+
+		for (size_t j = 0; j < count; j++)
+			instanceArray->push_back(product);
+	}
+
+	// A FIXED SEED GIVES THE SAME RESULT, WHATEVER NUMBER OF THREADS
+	for (int countGenes = 0; countGenes <= 1; countGenes++)
+		for (size_t islands = 1; islands <= 2; islands++)
+		{
+			string expected = optimize(wrapperArray, instanceArray, countGenes == 1, islands, 1);
+			CHECK(expected.empty() == false);
+
+			for (size_t threads = 2; threads <= 4; threads += 2)
+				CHECK(optimize(wrapperArray, instanceArray, countGenes == 1, islands, threads) == expected);
+
+			// AND REPEATEDLY
+			CHECK(optimize(wrapperArray, instanceArray, countGenes == 1, islands, 4) == expected);
+		}
+
+	// A COUNT MATRIX FROM A SEQUENCE LIST WITHOUT FEASIBILITY, SAME WITH ONE HAVING IT
+	{
+		vector<uint16_t> genes;
+		for (size_t i = 0; i < instanceArray->size(); i++)
+			genes.push_back((uint16_t)(engine() % 2));
+
+		GAWrapperArray plain(wrapperArray, instanceArray);
+		plain.assign(genes.begin(), genes.end());
+
+		GAWrapperArray feasible(instanceArray, make_shared<FeasibilityMatrix>(wrapperArray, instanceArray));
+		feasible.assign(genes.begin(), genes.end());
+
+		CHECK(plain.getFeasibility() == nullptr);
+		CHECK(GACountArray(plain).getFitness() == GACountArray(feasible).getFitness());
+	}
+
+	return test::report();
+}
@@ -0,0 +1,211 @@
+#include <bws/packer/WrapperGroup.hpp>
+#include <bws/packer/Product.hpp>
+
+#include <random>
+#include <string>
+#include <test.hpp>
+
+using namespace std;
+using namespace bws::packer;
+
+static const double EPSILON = 1e-6;
+
+/**
+ * @brief Digest of wrappers; positions and orientations of the wraps.
+ */
+static auto digest(const WrapperArray &wrapperArray) -> string
+{
+	string str;
+	for (size_t i = 0; i < wrapperArray.size(); i++)
+	{
+		shared_ptr<Wrapper> wrapper = wrapperArray.at(i);
+		str += "{";
+
+		for (size_t j = 0; j < wrapper->size(); j++)
+		{
+			shared_ptr<Wrap> wrap = wrapper->at(j);
+			str += to_string(wrap->getX()) + "," + to_string(wrap->getY()) + "," + to_string(wrap->getZ())
+				+ "#" + to_string(wrap->getOrientation()) + ";";
+		}
+		str += "}";
+	}
+	return str;
+};
+
+/**
+ * @brief Test whether wraps of a wrapper are within it, without overlapping each other.
+ */
+static auto valid(const Wrapper &wrapper) -> bool
+{
+	double thickness = wrapper.getThickness();
+
+	for (size_t i = 0; i < wrapper.size(); i++)
+	{
+		const Wrap &a = *wrapper.at(i);
+
+		if (a.getX() < thickness - EPSILON || a.getX() + a.getLayoutWidth() > thickness + wrapper.getContainableWidth() + EPSILON
+			|| a.getY() < thickness - EPSILON || a.getY() + a.getLayoutHeight() > thickness + wrapper.getContainableHeight() + EPSILON
+			|| a.getZ() < thickness - EPSILON || a.getZ() + a.getLayoutLength() > thickness + wrapper.getContainableLength() + EPSILON)
+			return false;
+
+		for (size_t j = 0; j < i; j++)
+		{
+			const Wrap &b = *wrapper.at(j);
+
+			if (a.getX() < b.getX() + b.getLayoutWidth() - EPSILON && b.getX() < a.getX() + a.getLayoutWidth() - EPSILON
+				&& a.getY() < b.getY() + b.getLayoutHeight() - EPSILON && b.getY() < a.getY() + a.getLayoutHeight() - EPSILON
+				&& a.getZ() < b.getZ() + b.getLayoutLength() - EPSILON && b.getZ() < a.getZ() + a.getLayoutLength() - EPSILON)
+				return false;
+		}
+	}
+	return true;
+};
+
+/**
+ * @brief Number of units in the best block pattern, like WrapperGroup::computeBlocks().
+ */
+static auto computeBlocks(const Wrapper &sample, const Instance &instance) -> size_t
+{
+	double w = instance.getWidth();
+	double h = instance.getHeight();
+	double l = instance.getLength();
+
+	double orientations[6][3] =
+	{
+		{ w, h, l }, { l, h, w }, { l, w, h },
+		{ h, w, l }, { w, l, h }, { h, l, w }
+	};
+	size_t best = 0;
+
+	for (size_t o = 0; o < 6; o++)
+		best = max(best, (size_t)floor(sample.getContainableWidth() / orientations[o][0])
+			* (size_t)floor(sample.getContainableHeight() / orientations[o][1])
+			* (size_t)floor(sample.getContainableLength() / orientations[o][2]));
+
+	return best;
+};
+
+/**
+ * @brief Pack units of a SKU by the plain loop; a new Wrapper for the left units, until exhausted.
+ */
+static auto packPlain(shared_ptr<Wrapper> sample, shared_ptr<Instance> instance, size_t n, PackingEngine &engine) -> WrapperArray
+{
+	WrapperArray wrapperArray;
+
+	shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+	instanceArray->assign(n, instance);
+
+	while (instanceArray->empty() == false)
+	{
+		auto pair = engine.pack(make_shared<Wrapper>(*sample), instanceArray);
+
+		wrapperArray.push_back(pair.first);
+		instanceArray = pair.second;
+	}
+	return wrapperArray;
+};
+
+/**
+ * @brief Pack units of a SKU by WrapperGroup::optimize(), by objects or by SKU ids.
+ */
+static auto packHomogeneous(shared_ptr<Wrapper> sample, shared_ptr<Instance> instance, size_t n, int engine, bool bySKU) -> WrapperArray
+{
+	WrapperGroup group(sample);
+	group.setEngine(engine);
+
+	if (bySKU == true)
+	{
+		shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+		instanceArray->push_back(instance);
+
+		group.allocateFeasible(make_shared<InstanceTable>(instanceArray), 0, n);
+	}
+	else
+		group.allocate(instance, n);
+
+	group.optimize();
+	return group;
+};
+
+int main()
+{
+	mt19937 random(2017);
+
+	boxologic::Boxologic boxologic;
+	ExtremePoint extremePoint;
+	size_t patterns = 0;
+	size_t copies = 0;
+
+	for (size_t trial = 0; trial < 40; trial++)
+	{
+		int engine = (trial % 2 == 0) ? PackingEngine::BOXOLOGIC : PackingEngine::EXTREME_POINT;
+		PackingEngine &packingEngine = (engine == PackingEngine::EXTREME_POINT)
+			? (PackingEngine&)extremePoint
+			: (PackingEngine&)boxologic;
+
+		shared_ptr<Wrapper> sample(new Wrapper("Box", 1000, 40 + random() % 60, 40 + random() % 60, 40 + random() % 60, (double)(random() % 2)));
+		shared_ptr<Instance> product(new Product("P", 5 + random() % 20, 5 + random() % 20, 5 + random() % 20));
+
+		// CAPACITY OF A WRAPPER BY THE ENGINE
+		shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+		instanceArray->assign(2000, product);
+
+		size_t capacity = packingEngine.pack(make_shared<Wrapper>(*sample), instanceArray).first->size();
+		size_t blocks = computeBlocks(*sample, *product);
+
+		if (capacity == 0)
+			continue;
+
+		// LESS THAN, EXACTLY AND SOME TIMES OF THE CAPACITY
+		vector<size_t> counts = { 1, capacity - 1, capacity, capacity + 1, 3 * capacity, 3 * capacity + capacity / 2 };
+		if (blocks > capacity)
+			counts.insert(counts.end(), { blocks - 1, blocks, 2 * blocks + 1 });
+
+		for (size_t i = 0; i < counts.size(); i++)
+		{
+			size_t n = counts[i];
+			if (n == 0)
+				continue;
+
+			WrapperArray plain = packPlain(sample, product, n, packingEngine);
+
+			for (int bySKU = 0; bySKU <= 1; bySKU++)
+			{
+				WrapperArray homogeneous = packHomogeneous(sample, product, n, engine, bySKU == 1);
+
+				// ALL UNITS ARE PACKED
+				size_t packed = 0;
+				for (size_t j = 0; j < homogeneous.size(); j++)
+					packed += homogeneous.at(j)->size();
+				CHECK(packed == n);
+
+				if (blocks > capacity && n >= blocks)
+				{
+					// THE BLOCK PATTERN WINS; VALID PATTERNS, NOT MORE WRAPPERS THAN THE PLAIN LOOP
+					for (size_t j = 0; j < n / blocks; j++)
+					{
+						CHECK(homogeneous.at(j)->size() == blocks);
+						CHECK(valid(*homogeneous.at(j)));
+					}
+					CHECK(homogeneous.size() <= plain.size());
+					patterns++;
+				}
+				else
+				{
+					// COPIES OF THE FIRST WRAPPER; SAME WITH THE PLAIN LOOP
+					CHECK(digest(homogeneous) == digest(plain));
+					copies++;
+				}
+				if (n <= capacity)
+					CHECK(homogeneous.size() == 1);
+			}
+		}
+	}
+
+	// BOTH CASES ARE COVERED
+	CHECK(patterns > 0);
+	CHECK(copies > 0);
+
+	printf("%d by block patterns, %d by copies\n", (int)patterns, (int)copies);
+	return test::report();
+};
@@ -0,0 +1,212 @@
+#include <boxologic/BoxTable.hpp>
+
+#include <random>
+#include <climits>
+#include <test.hpp>
+
+using namespace std;
+using namespace boxologic;
+
+/**
+ * @brief Evaluate a layer thickness by iterating all boxes, like Boxologic did before LayerEvaluator.
+ */
+static auto linear_evaluate(const vector<Box> &boxes, const BoxTable &table, size_t i, double ex_dim) -> double
+{
+	double eval = 0;
+
+	for (size_t k = 0; k < boxes.size(); k++)
+	{
+		const Box &box = boxes[k];
+		if (i == k || table.is_packed(k) == true)
+			continue;
+
+		eval += min
+		({
+			abs(ex_dim - box.width),
+			abs(ex_dim - box.height),
+			abs(ex_dim - box.length)
+		});
+	}
+	return eval;
+};
+
+/**
+ * @brief Candidate dimensions of a box, in order of Boxologic::find_layer().
+ */
+static void fetch_dims(double width, double height, double length, size_t j, double &ex_dim, double &dim2, double &dim3)
+{
+	switch (j)
+	{
+	case 1:
+		ex_dim = width; dim2 = height; dim3 = length;
+		break;
+	case 2:
+		ex_dim = height; dim2 = width; dim3 = length;
+		break;
+	default:
+		ex_dim = length; dim2 = width; dim3 = height;
+		break;
+	}
+};
+
+/**
+ * @brief Layer thickness chosen by the linear scan over boxes, before BoxTable and LayerEvaluator.
+ */
+static auto linear_find_layer(const vector<Box> &boxes, const BoxTable &table, double thickness, double width, double length) -> double
+{
+	double min_eval = INT_MAX;
+	double layer_thickness = 0;
+
+	for (size_t i = 0; i < boxes.size(); i++)
+	{
+		const Box &box = boxes[i];
+		if (table.is_packed(i) == true)
+			continue;
+
+		for (size_t j = 1; j <= 3; j++)
+		{
+			double ex_dim, dim2, dim3;
+			fetch_dims(box.width, box.height, box.length, j, ex_dim, dim2, dim3);
+
+			if (ex_dim <= thickness && ((dim2 <= width && dim3 <= length) || (dim3 <= width && dim2 <= length)))
+			{
+				double my_eval = linear_evaluate(boxes, table, i, ex_dim);
+				if (my_eval < min_eval)
+				{
+					min_eval = my_eval;
+					layer_thickness = ex_dim;
+				}
+			}
+		}
+	}
+	return layer_thickness;
+};
+
+/**
+ * @brief Layer thickness chosen over types by LayerEvaluator, same with Boxologic::find_layer().
+ */
+static auto typed_find_layer(const BoxTable &table, double thickness, double width, double length) -> double
+{
+	double min_eval = INT_MAX;
+	size_t min_index = (size_t)-1;
+	double layer_thickness = 0;
+
+	const vector<BoxType> &types = table.get_types();
+	for (size_t i = 0; i < types.size(); i++)
+	{
+		const BoxType &type = types[i];
+		if (type.remaining == 0)
+			continue;
+
+		size_t index = type.front();
+		for (size_t j = 1; j <= 3; j++)
+		{
+			double ex_dim, dim2, dim3;
+			fetch_dims(type.width, type.height, type.length, j, ex_dim, dim2, dim3);
+
+			if (ex_dim <= thickness && ((dim2 <= width && dim3 <= length) || (dim3 <= width && dim2 <= length)))
+			{
+				double my_eval = table.evaluate_layer(ex_dim);
+				if (my_eval < min_eval || (my_eval == min_eval && min_index != (size_t)-1 && index < min_index))
+				{
+					min_eval = my_eval;
+					min_index = index;
+					layer_thickness = ex_dim;
+				}
+			}
+		}
+	}
+	return layer_thickness;
+};
+
+int main()
+{
+	mt19937 engine(2017);
+	size_t comparisons = 0;
+
+	for (size_t trial = 0; trial < 300; trial++)
+	{
+		// INTEGRAL BOXES OF SOME TYPES, INCLUDING DUPLICATES AND SAME DIMENSIONS IN OTHER ORIENTATIONS
+		size_t types = 1 + engine() % 30;
+
+		vector<Box> boxes;
+		for (size_t t = 0; t < types; t++)
+		{
+			Box box = {};
+			box.width = 1 + engine() % 20;
+			box.height = 1 + engine() % 20;
+			box.length = (engine() % 4 == 0) ? box.width : 1 + engine() % 20;
+
+			size_t count = 1 + engine() % 6;
+			for (size_t i = 0; i < count; i++)
+			{
+				boxes.push_back(box);
+				if (engine() % 5 == 0)
+					swap(boxes.back().width, boxes.back().length);
+			}
+		}
+		shuffle(boxes.begin(), boxes.end(), engine);
+
+		BoxTable table;
+		table.assign(boxes);
+
+		// EACH BOX BELONGS TO EXACTLY ONE TYPE OF SAME DIMENSIONS, IN ASCENDING ORDER
+		const vector<BoxType> &boxTypes = table.get_types();
+		vector<size_t> owners(boxes.size(), 0);
+
+		for (size_t t = 0; t < boxTypes.size(); t++)
+		{
+			const BoxType &type = boxTypes[t];
+			CHECK(type.remaining == type.indices.size());
+
+			for (size_t k = 0; k < type.indices.size(); k++)
+			{
+				const Box &box = boxes[type.indices[k]];
+				CHECK(box.width == type.width && box.height == type.height && box.length == type.length);
+				CHECK(k == 0 || type.indices[k - 1] < type.indices[k]);
+
+				owners[type.indices[k]]++;
+			}
+
+			for (size_t u = 0; u < t; u++)
+				CHECK(boxTypes[u].width != type.width || boxTypes[u].height != type.height || boxTypes[u].length != type.length);
+		}
+		for (size_t i = 0; i < owners.size(); i++)
+			CHECK(owners[i] == 1);
+
+		// PACK BOXES ONE BY ONE, COMPARING CHOICES OF LAYERS WITH THE LINEAR SCAN
+		while (true)
+		{
+			double thickness = 1 + engine() % 25;
+			double width = 1 + engine() % 25;
+			double length = 1 + engine() % 25;
+
+			CHECK(typed_find_layer(table, thickness, width, length) == linear_find_layer(boxes, table, thickness, width, length));
+
+			for (size_t i = 0; i < boxes.size(); i++)
+			{
+				if (table.is_packed(i) == true)
+					continue;
+
+				double dims[3] = { boxes[i].width, boxes[i].height, boxes[i].length };
+				for (size_t j = 0; j < 3; j++)
+					CHECK(table.evaluate_layer(dims[j]) == linear_evaluate(boxes, table, i, dims[j]));
+			}
+			comparisons++;
+
+			// PACK A RANDOM BOX; THE FIRST REMAINED ONE OF A TYPE
+			vector<size_t> remains;
+			for (size_t t = 0; t < boxTypes.size(); t++)
+				if (boxTypes[t].remaining != 0)
+					remains.push_back(t);
+
+			if (remains.empty() == true)
+				break;
+
+			table.pack(boxTypes[remains[engine() % remains.size()]].front());
+		}
+	}
+
+	printf("%d comparisons\n", (int)comparisons);
+	return test::report();
+};
@@ -0,0 +1,135 @@
+#include <bws/packer/WrapperGroup.hpp>
+#include <bws/packer/Product.hpp>
+
+#include <random>
+#include <test.hpp>
+
+using namespace std;
+using namespace bws::packer;
+
+static size_t prunings = 0;
+
+/**
+ * @brief Choose the cheapest repacking of a wrapper, like Packer::repack().
+ *
+ * @param wrapper A packed wrapper.
+ * @param wrapperArray Types to repack to.
+ * @param instanceTable Distinct instances. nullptr to allocate them by objects.
+ * @param engine Type of the PackingEngine.
+ * @param prune Whether to skip the types of which lower bound is not cheaper.
+ *
+ * @return Price of the chosen repacking.
+ */
+static auto repack(shared_ptr<Wrapper> wrapper, shared_ptr<WrapperArray> wrapperArray, shared_ptr<InstanceTable> instanceTable, int engine, bool prune) -> double
+{
+	double price = wrapper->getPrice();
+
+	for (size_t i = 0; i < wrapperArray->size(); i++)
+	{
+		shared_ptr<WrapperGroup> group(new WrapperGroup(wrapperArray->at(i)));
+		group->setEngine(engine);
+
+		bool feasible = true;
+		for (size_t j = 0; j < wrapper->size() && feasible == true; j++)
+		{
+			shared_ptr<Instance> instance = wrapper->at(j)->getInstance();
+
+			if (wrapperArray->at(i)->operator>=(*instance) == false)
+				feasible = false;
+			else if (instanceTable == nullptr)
+				group->allocateFeasible(instance);
+			else
+				group->allocateFeasible(instanceTable, instanceTable->indexOf(*instance));
+		}
+		if (feasible == false)
+			continue;
+
+		size_t lowerBound = group->getLowerBound();
+		if (prune == true && lowerBound * wrapperArray->at(i)->getPrice() >= wrapper->getPrice())
+		{
+			prunings++;
+			continue;
+		}
+
+		group->optimize();
+
+		// THE BOUND NEVER EXCEEDS THE PACKED NUMBER
+		CHECK(lowerBound <= group->size());
+
+		if (group->getPrice() < price)
+			price = group->getPrice();
+	}
+	return price;
+};
+
+int main()
+{
+	mt19937 engine(2017);
+
+	// LARGE INSTANCES AND INSTANCES WHICH CANNOT SHARE A WRAPPER WITH THEM
+	{
+		shared_ptr<Instance> large(new Product("Large", 6, 6, 6));
+		shared_ptr<Instance> medium(new Product("Medium", 5, 5, 5));
+		shared_ptr<Instance> thin(new Product("Thin", 4, 6, 6));
+
+		WrapperGroup group("Box", 1000, 10, 10, 10, 0);
+		group.allocate(large, 2);
+		group.allocate(medium, 2);
+		CHECK(group.getLowerBound() == 3);
+
+		group.optimize();
+		CHECK(group.size() == 3);
+
+		// A THIN ONE CAN BE PLACED BESIDE A LARGE ONE
+		WrapperGroup thinGroup("Box", 1000, 10, 10, 10, 0);
+		thinGroup.allocate(large, 2);
+		thinGroup.allocate(thin, 2);
+		CHECK(thinGroup.getLowerBound() == 2);
+	}
+
+	// RESULTS OF REPACKING ARE SAME, WITH OR WITHOUT PRUNING
+	for (size_t trial = 0; trial < 60; trial++)
+	{
+		shared_ptr<WrapperArray> wrapperArray(new WrapperArray());
+		wrapperArray->emplace_back(new Wrapper("Large", 1000, 100, 80, 120, 0));
+		wrapperArray->emplace_back(new Wrapper("Medium", 450, 70, 60, 80, 1));
+		wrapperArray->emplace_back(new Wrapper("Small", 200, 50, 40, 50, 0));
+		wrapperArray->emplace_back(new Wrapper("Flat", 300, 90, 20, 90, 0));
+
+		// INSTANCES PACKED IN THE LARGE TYPE; SOME OF THEM ARE LARGE FOR SMALLER TYPES
+		shared_ptr<InstanceArray> instanceArray(new InstanceArray());
+		size_t skus = 1 + engine() % 4;
+
+		for (size_t i = 0; i < skus; i++)
+		{
+			shared_ptr<Instance> product(new Product
+			(
+				"P" + to_string(i),
+				10 + engine() % 30, 10 + engine() % 30, 10 + engine() % 30
+			));
+			instanceArray->insert(instanceArray->end(), 1 + engine() % 8, product);
+		}
+
+		int packingEngine = (trial % 2 == 0) ? PackingEngine::BOXOLOGIC : PackingEngine::EXTREME_POINT;
+		shared_ptr<InstanceTable> instanceTable = (trial % 3 == 0) ? nullptr : make_shared<InstanceTable>(instanceArray);
+
+		WrapperGroup group(wrapperArray->front());
+		group.setEngine(packingEngine);
+		for (size_t i = 0; i < instanceArray->size(); i++)
+			group.allocate(instanceArray->at(i));
+		group.optimize();
+
+		for (size_t i = 0; i < group.size(); i++)
+		{
+			double pruned = repack(group.at(i), wrapperArray, instanceTable, packingEngine, true);
+			double full = repack(group.at(i), wrapperArray, instanceTable, packingEngine, false);
+
+			CHECK(pruned == full);
+		}
+	}
+
+	CHECK(prunings > 0);
+
+	printf("%d prunings\n", (int)prunings);
+	return test::report();
+};
@@ -0,0 +1,65 @@
+#include <samchon/library/Random.hpp>
+
+#include <test.hpp>
+
+using namespace samchon::library;
+
+int main()
+{
+	// REFERENCE IMPLEMENTATION OF XOSHIRO256**, FROM STATE { 1, 2, 3, 4 }
+	{
+		Random random;
+		random.setState({ 1, 2, 3, 4 });
+
+		const uint64_t expected[8] =
+		{
+			11520ULL, 0ULL, 1509978240ULL, 1215971899390074240ULL,
+			1216172134540287360ULL, 607988272756665600ULL, 16172922978634559625ULL, 8476171486693032832ULL
+		};
+		for (size_t i = 0; i < 8; i++)
+			CHECK(random() == expected[i]);
+	}
+
+	// SEEDING BY SPLITMIX64; PINNED, SO THAT A SEED REPRODUCES SAME RESULTS IN ANY VERSION
+	{
+		Random random(42);
+		CHECK(random.getState()[0] == 0xfc991bca1a1aa1aeULL);
+		CHECK(random.getState()[3] == 0x01396e37180ee2cbULL);
+
+		const uint64_t expected[4] = { 1174369944940139690ULL, 4110381810479951568ULL, 8451825786417865615ULL, 7824076363180783516ULL };
+		for (size_t i = 0; i < 4; i++)
+			CHECK(random() == expected[i]);
+	}
+	{
+		Random random({ 42, 1 });
+
+		const uint64_t expected[4] = { 16740160775094334808ULL, 6525585876961756127ULL, 670810101252768773ULL, 13678938328259497375ULL };
+		for (size_t i = 0; i < 4; i++)
+			CHECK(random() == expected[i]);
+	}
+	{
+		Random random;
+
+		const uint64_t expected[2] = { 2009797444621045065ULL, 14096491090008978578ULL };
+		for (size_t i = 0; i < 2; i++)
+			CHECK(random() == expected[i]);
+	}
+
+	// STREAMS OF A SEED ARE DIFFERENT
+	{
+		Random x({ 42, 0 });
+		Random y({ 42, 1 });
+		CHECK(x() != y());
+	}
+
+	// RANDOM VALUES ARE IN [0, 1)
+	{
+		Random random(7);
+		for (size_t i = 0; i < 10000; i++)
+		{
+			double value = random.random();
+			CHECK(value >= 0.0 && value < 1.0);
+		}
+	}
+	return test::report();
+}
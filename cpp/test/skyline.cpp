@@ -0,0 +1,113 @@
+#include <boxologic/Skyline.hpp>
+
+#include <list>
+#include <random>
+#include <iterator>
+#include <test.hpp>
+
+using namespace std;
+using namespace boxologic;
+
+/**
+ * @brief Position of the first scrap having the smallest z, like Boxologic::find_smallest_z() did before Skyline.
+ */
+static auto linear_find_smallest_z(const list<Scrappad> &scraps) -> size_t
+{
+	auto min_z = scraps.begin();
+	for (auto it = scraps.begin(); it != scraps.end(); it++)
+		if (it->cumz < min_z->cumz)
+			min_z = it;
+
+	return distance(scraps.begin(), min_z);
+};
+
+static auto position(const Skyline &skyline, Skyline::iterator it) -> size_t
+{
+	size_t ret = 0;
+	for (auto x = skyline.begin(); x != it; x++)
+		ret++;
+
+	return ret;
+};
+
+static auto same(const Skyline &skyline, const list<Scrappad> &scraps) -> bool
+{
+	if (skyline.size() != scraps.size())
+		return false;
+
+	auto it = skyline.begin();
+	for (auto x = scraps.begin(); x != scraps.end(); x++, it++)
+		if (it->cumx != x->cumx || it->cumz != x->cumz)
+			return false;
+
+	return it == skyline.end();
+};
+
+int main()
+{
+	mt19937 engine(2017);
+	size_t comparisons = 0;
+
+	for (size_t trial = 0; trial < 100; trial++)
+	{
+		Skyline skyline;
+		list<Scrappad> scraps;
+
+		Scrappad first = { 0, 0 };
+		skyline.push_back(first);
+		scraps.push_back(first);
+
+		// RANDOM MODIFICATIONS OF INTEGRAL SCRAPS; MANY TIES OF Z
+		for (size_t step = 0; step < 1000; step++)
+		{
+			size_t index = engine() % scraps.size();
+
+			auto it = skyline.begin();
+			auto x = scraps.begin();
+			for (size_t i = 0; i < index; i++)
+			{
+				it++;
+				x++;
+			}
+
+			Scrappad scrap = { (double)(engine() % 100), (double)(engine() % 10) };
+
+			switch (engine() % 4)
+			{
+			case 0:
+				skyline.insert(it, scrap);
+				scraps.insert(x, scrap);
+				break;
+			case 1:
+				if (scraps.size() > 1)
+				{
+					skyline.erase(it);
+					scraps.erase(x);
+				}
+				break;
+			case 2:
+				skyline.set_cumz(it, scrap.cumz);
+				x->cumz = scrap.cumz;
+				break;
+			default:
+				skyline.set_cumx(it, scrap.cumx);
+				x->cumx = scrap.cumx;
+				break;
+			}
+
+			CHECK(same(skyline, scraps));
+			CHECK(position(skyline, skyline.min()) == linear_find_smallest_z(scraps));
+			comparisons++;
+		}
+
+		// ERASE A RANGE, AND RECYCLE THE ERASED NODES
+		skyline.erase(skyline.begin(), skyline.end());
+		scraps.clear();
+
+		CHECK(skyline.empty() == true);
+		CHECK(skyline.min() == skyline.end());
+	}
+
+	printf("%d comparisons\n", (int)comparisons);
+	return test::report();
+};
@@ -0,0 +1,148 @@
+#include <bws/packer/SolverPool.hpp>
+
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <stdexcept>
+#include <condition_variable>
+#include <test.hpp>
+
+using namespace std;
+using namespace bws::packer;
+
+/**
+ * @brief A gate holding the solver, until it's opened.
+ */
+class Gate
+{
+private:
+	mutex mtx;
+	condition_variable cv;
+	bool opened = false;
+
+public:
+	void wait()
+	{
+		unique_lock<mutex> uk(mtx);
+		cv.wait(uk, [this]() { return opened; });
+	};
+
+	void open()
+	{
+		{
+			unique_lock<mutex> uk(mtx);
+			opened = true;
+		}
+		cv.notify_all();
+	};
+};
+
+/**
+ * @brief Wait until a condition holds, for a second at most.
+ */
+template <typename Condition>
+static auto await(Condition condition) -> bool
+{
+	for (size_t i = 0; i < 1000; i++)
+	{
+		if (condition() == true)
+			return true;
+
+		this_thread::sleep_for(chrono::milliseconds(1));
+	}
+	return condition();
+};
+
+int main()
+{
+	// OWNERS; ANY ADDRESSES
+	int a, b, c;
+
+	// A SOLVER, 3 WAITING JOBS AT MOST AND 2 OF AN OWNER
+	SolverPool pool(1, 3, 2);
+	CHECK(pool.size() == 1);
+
+	// ADMISSION LIMITS AND ROUND-ROBIN ORDER
+	{
+		Gate gate;
+		mutex mtx;
+		vector<int> order;
+
+		auto job = [&](int id)
+		{
+			return [&, id]()
+			{
+				unique_lock<mutex> uk(mtx);
+				order.push_back(id);
+			};
+		};
+
+		// THE SOLVER IS HELD BY THE FIRST JOB
+		CHECK(pool.push(&a, [&]() { gate.wait(); }) == true);
+		CHECK(await([&]() { return pool.getActive() == 1; }));
+
+		CHECK(pool.push(&a, job(1)) == true);
+		CHECK(pool.push(&a, job(2)) == true);
+		CHECK(pool.push(&a, job(3)) == false); // LIMIT OF AN OWNER
+		CHECK(pool.push(&b, job(4)) == true);
+		CHECK(pool.push(&c, job(5)) == false); // LIMIT OF THE QUEUE
+
+		CHECK(pool.getDepth() == 3);
+		CHECK(pool.getPeakDepth() == 3);
+		CHECK(pool.getAccepted() == 4);
+		CHECK(pool.getRejected() == 2);
+
+		// OWNERS TAKE TURNS; A JOB OF B BETWEEN JOBS OF A
+		gate.open();
+		CHECK(await([&]() { return pool.getCompleted() == 4; }));
+
+		CHECK(order == vector<int>({ 1, 4, 2 }));
+		CHECK(pool.getDepth() == 0);
+		CHECK(pool.getActive() == 0);
+	}
+
+	// ERASE WAITING JOBS OF AN OWNER
+	{
+		Gate gate;
+		mutex mtx;
+		vector<const void*> owners;
+
+		auto job = [&](const void *owner)
+		{
+			return [&, owner]()
+			{
+				unique_lock<mutex> uk(mtx);
+				owners.push_back(owner);
+			};
+		};
+
+		CHECK(pool.push(&c, [&]() { gate.wait(); }) == true);
+		CHECK(await([&]() { return pool.getActive() == 1; }));
+
+		CHECK(pool.push(&a, job(&a)) == true);
+		CHECK(pool.push(&b, job(&b)) == true);
+		CHECK(pool.push(&a, job(&a)) == true);
+
+		CHECK(pool.erase(&a) == 2);
+		CHECK(pool.erase(&a) == 0);
+		CHECK(pool.getDepth() == 1);
+
+		// THE ERASED OWNER CAN PUSH AGAIN
+		CHECK(pool.push(&a, job(&a)) == true);
+
+		gate.open();
+		CHECK(await([&]() { return pool.getCompleted() == 7; }));
+
+		CHECK(owners == vector<const void*>({ &b, &a }));
+	}
+
+	// A FAILED JOB DOES NOT KILL THE SOLVER
+	{
+		CHECK(pool.push(&a, []() { throw runtime_error("failed"); }) == true);
+		CHECK(pool.push(&a, []() {}) == true);
+		CHECK(await([&]() { return pool.getCompleted() == 9; }));
+	}
+
+	return test::report();
+};
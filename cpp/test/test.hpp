@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * @brief Minimal checks of the tests.
+ *
+ * @details
+ * <p> Each test is an executable; CHECK() reports a failed condition with its location and counts it,
+ * and the test's main() returns test::report(), which is non-zero if any check has failed. </p>
+ */
+namespace test
+{
+	inline auto failures() -> int&
+	{
+		static int count = 0;
+		return count;
+	};
+
+	inline void check(bool condition, const char *expression, const char *file, int line)
+	{
+		if (condition == true)
+			return;
+
+		std::printf("%s:%d: CHECK(%s) failed\n", file, line, expression);
+		failures()++;
+	};
+
+	inline auto report() -> int
+	{
+		if (failures() == 0)
+			std::printf("OK\n");
+		else
+			std::printf("%d check(s) failed\n", failures());
+
+		return (failures() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+	};
+};
+
+#define CHECK(condition) test::check((condition), #condition, __FILE__, __LINE__)